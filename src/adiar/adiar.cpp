@@ -8,8 +8,18 @@
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/block_size.h>
+#include <adiar/internal/data_structures/buffer_pool.h>
+#include <adiar/internal/io/file_pool.h>
+#include <adiar/internal/io/page_cache.h>
+#include <adiar/internal/io/temp_dir.h>
 #include <adiar/internal/memory.h>
 
+namespace adiar::internal
+{
+  bool memory_accounting = false;
+  bool memory_hard_limit = false;
+}
+
 namespace adiar
 {
   /// \brief Whether Adiar is initialized.
@@ -18,6 +28,9 @@ namespace adiar
   /// \brief Whether TPIE is initialized.
   bool _tpie_initialized = false;
 
+  /// \brief Whether obsolete temporary files are to be recycled.
+  bool _file_recycling = false;
+
   /// \brief Subsystems of TPIE to be enabled
   const tpie::flags<tpie::subsystem> _tpie_subsystems =
     // Enable subsystems we use directly from Adiar
@@ -52,8 +65,29 @@ namespace adiar
   dev_null _devnull;
 #endif
 
+  /// \brief Apply the given memory limit mode to TPIE's memory manager.
+  void
+  __set_memory_enforcement(const memory_limit_mode m)
+  {
+    tpie::get_memory_manager().set_enforcement(m == memory_limit_mode::Hard
+                                                 ? tpie::memory_manager::ENFORCE_THROW
+                                                 : tpie::memory_manager::ENFORCE_WARN);
+  }
+
+  void
+  adiar_init(size_t memory_limit_bytes, std::string temp_dir, const io_mode io)
+  {
+    if (temp_dir == "") {
+      adiar_init(memory_limit_bytes, std::vector<std::string>(), io);
+    } else {
+      adiar_init(memory_limit_bytes, std::vector<std::string>{ temp_dir }, io);
+    }
+  }
+
   void
-  adiar_init(size_t memory_limit_bytes, std::string temp_dir)
+  adiar_init(size_t memory_limit_bytes,
+             const std::vector<std::string>& temp_dirs,
+             const io_mode io)
   {
     if (_adiar_initialized) {
 #ifndef NDEBUG
@@ -78,8 +112,8 @@ namespace adiar
       tpie::tempname::set_default_base_name("ADIAR");
       tpie::tempname::set_default_extension("adiar");
 
-      // - tmp directory
-      if (temp_dir != "") { tpie::tempname::set_default_path(temp_dir); }
+      // - tmp directory (TPIE's own files are placed in the first one)
+      if (!temp_dirs.empty()) { tpie::tempname::set_default_path(temp_dirs.front()); }
 
       // Initialise TPIE
       tpie::tpie_init(_tpie_subsystems);
@@ -92,8 +126,21 @@ namespace adiar
 
       // - memory limit and block size
       tpie::get_memory_manager().set_limit(memory_limit_bytes);
+      __set_memory_enforcement(adiar_memory_limit_mode());
+      internal::memory_accounting = true;
+
       internal::set_block_size(internal::recommended_block_size(memory_limit_bytes));
 
+      // - directories for temporary files
+      internal::temp_dir_init(temp_dirs);
+
+      // - recycling of temporary files
+      internal::file_pool_init(
+        _file_recycling ? internal::recommended_file_pool_size(memory_limit_bytes) : 0u);
+
+      // - page cache usage
+      internal::page_cache_evict_set(io == io_mode::Evict);
+
       _tpie_initialized = true;
 
       // Initialise Adiar state
@@ -105,8 +152,9 @@ namespace adiar
     } catch (const std::exception& e) {
       // LCOV_EXCL_START
       // Mark as not initialized.
-      _adiar_initialized = false;
-      _tpie_initialized  = true;
+      _adiar_initialized          = false;
+      _tpie_initialized           = true;
+      internal::memory_accounting = false;
 
       // Try to gracefully close down TPIE.
       tpie::tpie_finish(_tpie_subsystems);
@@ -129,7 +177,12 @@ namespace adiar
     if (!_adiar_initialized) return;
 
     domain_unset();
+    internal::file_pool_deinit();
+    internal::temp_dir_deinit();
+    internal::page_cache_evict_set(false);
+    internal::buffer_pool_clear();
 
+    internal::memory_accounting = false;
     tpie::tpie_finish(_tpie_subsystems);
     _adiar_initialized = false;
 
@@ -138,4 +191,58 @@ namespace adiar
     //
     // See: 'https://github.com/thomasmoelhave/tpie/issues/265'
   }
+
+  void
+  adiar_set_file_recycling(const bool enable)
+  {
+    _file_recycling = enable;
+    if (_adiar_initialized) {
+      internal::file_pool_init(
+        enable ? internal::recommended_file_pool_size(tpie::get_memory_manager().limit()) : 0u);
+    }
+  }
+
+  bool
+  adiar_file_recycling() noexcept
+  {
+    return _file_recycling;
+  }
+
+  void
+  adiar_set_memory_limit_mode(const memory_limit_mode m)
+  {
+    internal::memory_hard_limit = m == memory_limit_mode::Hard;
+    if (_adiar_initialized) { __set_memory_enforcement(m); }
+  }
+
+  memory_limit_mode
+  adiar_memory_limit_mode() noexcept
+  {
+    return internal::memory_hard_limit ? memory_limit_mode::Hard : memory_limit_mode::Soft;
+  }
+
+  void
+  adiar_set_memory_limit(size_t memory_limit_bytes)
+  {
+    if (!_adiar_initialized) {
+      throw domain_error("Adiar must be initialized before its memory limit can be changed");
+    }
+    if (memory_limit_bytes < minimum_memory) {
+      throw invalid_argument("Adiar requires at least "
+                             + std::to_string(minimum_memory / 1024 / 1024) + " MiB of memory");
+    }
+    // Idle buffers are sized (and bounded) relative to the previous memory limit.
+    internal::buffer_pool_clear();
+
+    if (internal::memory_hard_limit && memory_limit_bytes < internal::memory_used()) {
+      throw invalid_argument("Memory limit is less than the memory currently in use");
+    }
+    tpie::get_memory_manager().set_limit(memory_limit_bytes);
+  }
+
+  size_t
+  adiar_memory_limit() noexcept
+  {
+    return _adiar_initialized ? tpie::get_memory_manager().limit() : 0u;
+  }
 }
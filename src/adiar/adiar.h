@@ -8,6 +8,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <string>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 #include <adiar/version.h>
@@ -57,6 +58,41 @@ namespace adiar
   //////////////////////////////////////////////////////////////////////////////////////////////////
   constexpr size_t minimum_memory = 128 * 1024 * 1024;
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   How Adiar's files should interact with the operating system's page cache.
+  ///
+  /// \details Adiar (through TPIE) buffers every block it reads and writes within the memory given
+  ///          to `adiar_init`. When decision diagrams exceed the machine's memory, the page cache
+  ///          of the operating system only doubles the memory used per block and evicts the pages
+  ///          of other processes.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  enum class io_mode : char
+  {
+    /** Leave the caching of files to the operating system. */
+    Buffered,
+    /** Evict each file from the page cache when a stream to it is closed. This is not `O_DIRECT`:
+        files are still cached while being written. Since dirty pages cannot be evicted, closing
+        a written file waits for it to be flushed to disk. */
+    Evict
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Whether the memory limit given to `adiar_init` may be exceeded.
+  ///
+  /// \details All of Adiar's data structures, including the bookkeeping of each decision diagram,
+  ///          account for their memory in TPIE's memory manager. Yet, with a *soft* limit, TPIE
+  ///          only warns about an allocation that goes beyond the limit. With a *hard* limit, the
+  ///          allocation fails with an `out_of_memory` exception instead, which leaves the process
+  ///          within the limit (e.g. the one of its cgroup).
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  enum class memory_limit_mode : char
+  {
+    /** Warn about allocations beyond the memory limit. */
+    Soft,
+    /** Throw an `out_of_memory` exception for allocations beyond the memory limit. */
+    Hard
+  };
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Initiates Adiar with the given amount of memory (given in bytes)
   ///
@@ -67,6 +103,10 @@ namespace adiar
   /// \param temp_dir
   ///   The directory in which to place all temporary files. Default on Linux is the */tmp* library.
   ///
+  /// \param io
+  ///   Whether to keep Adiar's files out of the operating system's page cache (default is
+  ///   `io_mode::Buffered`).
+  ///
   /// \throws invalid_argument
   ///   If `memory_limit_bytes` is set to a value less than the `minimum_memory` required.
   ///
@@ -74,7 +114,48 @@ namespace adiar
   ///   If `adiar_init()` and then `adiar_deinit()` have been called previously.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   void
-  adiar_init(size_t memory_limit_bytes, std::string temp_dir = "");
+  adiar_init(size_t memory_limit_bytes,
+             std::string temp_dir = "",
+             const io_mode io     = io_mode::Buffered);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Initiates Adiar with the given amount of memory (given in bytes) and multiple
+  ///        directories for temporary files.
+  ///
+  /// \details If the directories are placed on different drives, then Adiar spreads its temporary
+  ///          files across them. Since each algorithm reads its input while writing its output,
+  ///          this places the streams of each algorithm on different drives (assuming they are
+  ///          created in sequence). TPIE's internal files (e.g. the runs of a sorter) are placed in
+  ///          the first directory.
+  ///
+  ///          For example, to use two NVMe drives:
+  ///          ```cpp
+  ///          adiar_init(8ul * 1024 * 1024 * 1024,
+  ///                     std::vector<std::string>{ "/mnt/nvme0/tmp", "/mnt/nvme1/tmp" });
+  ///          ```
+  ///
+  /// \param memory_limit_bytes
+  ///   The amount of internal memory (in bytes) that Adiar is allowed to use. This has to be at
+  ///   least minimum_memory.
+  ///
+  /// \param temp_dirs
+  ///   The directories in which to place all temporary files. If empty, then the default of TPIE is
+  ///   used (on Linux, this is the */tmp* library).
+  ///
+  /// \param io
+  ///   Whether to keep Adiar's files out of the operating system's page cache (default is
+  ///   `io_mode::Buffered`).
+  ///
+  /// \throws invalid_argument
+  ///   If `memory_limit_bytes` is set to a value less than the `minimum_memory` required.
+  ///
+  /// \throws runtime_error
+  ///   If `adiar_init()` and then `adiar_deinit()` have been called previously.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_init(size_t memory_limit_bytes,
+             const std::vector<std::string>& temp_dirs,
+             const io_mode io = io_mode::Buffered);
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Whether Adiar is initialized.
@@ -95,6 +176,71 @@ namespace adiar
   void
   adiar_deinit();
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Set whether obsolete temporary files are recycled rather than deleted (default is
+  ///          `false`).
+  ///
+  /// \details On network and overlay file systems, the creation and deletion of files can dominate
+  ///          the running time of operations on medium-sized decision diagrams. With recycling, an
+  ///          obsolete file is truncated and kept around to be reused for the next one. On local
+  ///          file systems, this is slower: for example on *ext4*, reopening a truncated file
+  ///          forces its delayed allocations to be flushed to disk.
+  ///
+  ///          This may be called both before and after `adiar_init`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_set_file_recycling(const bool enable);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether obsolete temporary files are recycled.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bool
+  adiar_file_recycling() noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Set whether the memory limit may be exceeded (default is `memory_limit_mode::Soft`).
+  ///
+  /// \details This may be called both before and after `adiar_init`. With a hard memory limit, a
+  ///          small part of the memory is reserved for the bookkeeping of decision diagrams. Hence,
+  ///          each algorithm has slightly less memory available for its data structures.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_set_memory_limit_mode(const memory_limit_mode m);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether the memory limit may be exceeded.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  memory_limit_mode
+  adiar_memory_limit_mode() noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Change the memory limit (given in bytes) in-between operations.
+  ///
+  /// \details This grows or shrinks the memory available to all subsequent operations. With too
+  ///          little memory, algorithms degrade gracefully, e.g. Nested Sweeping is replaced by
+  ///          single-variable sweeps and priority queues are run without look-ahead. Yet, the
+  ///          block size chosen by `adiar_init` is kept, since all existing files depend on it.
+  ///
+  /// \param memory_limit_bytes
+  ///   The new amount of internal memory (in bytes) that Adiar is allowed to use. This has to be
+  ///   at least minimum_memory.
+  ///
+  /// \throws invalid_argument
+  ///   If `memory_limit_bytes` is set to a value less than the `minimum_memory` required or, with a
+  ///   hard memory limit, less than the memory currently in use.
+  ///
+  /// \throws domain_error
+  ///   If Adiar is not initialized.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_set_memory_limit(size_t memory_limit_bytes);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The current memory limit (in bytes) or `0` if Adiar is not initialized.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  size_t
+  adiar_memory_limit() noexcept;
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 
@@ -15,6 +15,7 @@
 #include <iostream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <adiar/bdd/bdd.h>
 #include <adiar/bool_op.h>
@@ -367,6 +368,38 @@ namespace adiar
   __bdd
   bdd_apply(const exec_policy& ep, const bdd& f, const bdd& g, const predicate<bool, bool>& op);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Apply a binary operator between each of many BDDs and a common BDD.
+  ///
+  /// \details Computes the same as calling `bdd_apply(f, g, op)` for each `f` in `fs`. But, the
+  ///          products are computed together within (a few) shared sweeps. That is, each level of
+  ///          the common operand `g` is only read once for all of them.
+  ///
+  /// \param fs
+  ///    BDDs for the left-hand-side of the operator
+  ///
+  /// \param g
+  ///    Common BDD for the right-hand-side of the operator
+  ///
+  /// \param op
+  ///    Binary predicate on `bool` to-be applied.
+  ///
+  /// \returns \f$ f \mathbin{\mathit{op}} g\f$ for each \f$ f \f$ in `fs` (in the same order).
+  ///
+  /// \see bool_op
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<__bdd>
+  bdd_apply(const std::vector<bdd>& fs, const bdd& g, const predicate<bool, bool>& op);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Apply a binary operator between each of many BDDs and a common BDD.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<__bdd>
+  bdd_apply(const exec_policy& ep,
+            const std::vector<bdd>& fs,
+            const bdd& g,
+            const predicate<bool, bool>& op);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Logical 'and' operator.
   ///
@@ -743,6 +776,32 @@ namespace adiar
                const bdd& f,
                const generator<pair<bdd::label_type, bool>>& xs);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Restrict a subset of variables to constant values in each of many BDDs.
+  ///
+  /// \details Computes the same as calling `bdd_restrict(f, xs)` for each `f` in `fs`. But, all
+  ///          BDDs are restricted together within (a few) shared sweeps. That is, the assignment
+  ///          `xs` is only read once for all of them.
+  ///
+  /// \param fs
+  ///    BDDs to restrict.
+  ///
+  /// \param xs
+  ///    Assignments (i,v) to variables in (in ascending order).
+  ///
+  /// \returns  \f$ f|_{(i,v) \in xs : x_i = v} \f$ for each \f$ f \f$ in `fs` (in the same order).
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<__bdd>
+  bdd_restrict(const std::vector<bdd>& fs, const generator<pair<bdd::label_type, bool>>& xs);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Restrict a subset of variables to constant values in each of many BDDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<__bdd>
+  bdd_restrict(const exec_policy& ep,
+               const std::vector<bdd>& fs,
+               const generator<pair<bdd::label_type, bool>>& xs);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief   Restrict a subset of variables to constant values.
   ///
@@ -818,6 +877,65 @@ namespace adiar
   __bdd
   bdd_high(const exec_policy& ep, const bdd& f);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Generalized cofactor of `f` with respect to `c` (Coudert and Madre's *constrain*).
+  ///
+  /// \details Computes a BDD that agrees with `f` on all assignments that satisfy `c`, i.e. such
+  ///          that \f$ f \land c = \texttt{bdd\_constrain}(f,c) \land c \f$. This is done by
+  ///          recursing on `f` and `c` together; whenever one of the branches of `c` is `false`,
+  ///          the corresponding node is skipped and replaced by the other branch.
+  ///
+  /// \param f
+  ///    BDD to minimise.
+  ///
+  /// \param c
+  ///    BDD of the assignments that \em care.
+  ///
+  /// \returns  \f$ f \downarrow c \f$, or `false` if `c` is unsatisfiable.
+  ///
+  /// \remark  The result may depend on variables in `c` that are not present in `f`. If this is
+  ///          undesirable, use `bdd_simplify` instead.
+  ///
+  /// \see bdd_simplify
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_constrain(const bdd& f, const bdd& c);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Generalized cofactor of `f` with respect to `c` (Coudert and Madre's *constrain*).
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_constrain(const exec_policy& ep, const bdd& f, const bdd& c);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Minimise `f` with respect to the don't-care set \f$ \neg \texttt{care} \f$ (Coudert
+  ///          and Madre's *restrict*).
+  ///
+  /// \details Computes a BDD that agrees with `f` on all assignments that satisfy `care`, i.e. such
+  ///          that \f$ f \land care = \texttt{bdd\_simplify}(f,care) \land care \f$. Unlike
+  ///          `bdd_constrain`, the result only ever depends on variables in `f`: all others are
+  ///          first existentially quantified in `care`. Furthermore, `care` is not split on a
+  ///          variable that `f` skips, if it can be avoided.
+  ///
+  /// \param f
+  ///    BDD to minimise.
+  ///
+  /// \param care
+  ///    BDD of the assignments that \em care.
+  ///
+  /// \returns  \f$ f \Downarrow care \f$, or `false` if `care` is unsatisfiable.
+  ///
+  /// \see bdd_constrain
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_simplify(const bdd& f, const bdd& care);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Minimise `f` with respect to the don't-care set \f$ \neg \texttt{care} \f$.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_simplify(const exec_policy& ep, const bdd& f, const bdd& care);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief   Existential quantification of a single variable.
   ///
@@ -1886,6 +2004,36 @@ namespace adiar
   uint64_t
   bdd_satcount(const exec_policy& ep, const bdd& f);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Weighted model count, i.e. the sum of the weights of all assignments x that make
+  ///          f(x) true.
+  ///
+  /// \details The weight of an assignment is the product of the weights of its literals. Variables
+  ///          that are not in `f` contribute with the sum of the weights of both of their literals.
+  ///
+  /// \param f
+  ///    BDD to count within.
+  ///
+  /// \param w
+  ///    A (pure) function that provides the weight of each literal, i.e. of each variable and its
+  ///    value. For example, if `w(x, false) + w(x, true) = 1` for all `x`, then this is the
+  ///    probability of `f` being true.
+  ///
+  /// \returns The weighted sum of all satisfying assignments to the variables of the global domain
+  ///          and the variables within the given BDD.
+  ///
+  /// \see domain_set
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  double
+  bdd_wmc(const bdd& f, const weight<bdd::label_type>& w);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Weighted model count, i.e. the sum of the weights of all assignments x that make f(x)
+  ///        true.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  double
+  bdd_wmc(const exec_policy& ep, const bdd& f, const weight<bdd::label_type>& w);
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -1964,6 +2112,12 @@ namespace adiar
   bdd
   bdd_satmin(const bdd& f);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The lexicographically smallest cube x such that f(x) is true.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_satmin(const exec_policy& ep, const bdd& f);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief The lexicographically smallest x such that f(x) is true within the given domain.
   ///
@@ -1981,6 +2135,15 @@ namespace adiar
              const generator<bdd::label_type>& d,
              const size_t d_size = bdd::max_label + 1);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The lexicographically smallest x such that f(x) is true within the given domain.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_satmin(const exec_policy& ep,
+             const bdd& f,
+             const generator<bdd::label_type>& d,
+             const size_t d_size = bdd::max_label + 1);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief The lexicographically smallest x such that f(x) is true.
   ///
@@ -2020,6 +2183,12 @@ namespace adiar
   bdd
   bdd_satmin(const bdd& f, const bdd& d);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The lexicographically smallest x such that f(x) is true.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_satmin(const exec_policy& ep, const bdd& f, const bdd& d);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief The lexicographically smallest x such that f(x) is true.
   ///
@@ -2063,6 +2232,12 @@ namespace adiar
   bdd
   bdd_satmax(const bdd& f);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The lexicographically largest cube x such that f(x) is true.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_satmax(const exec_policy& ep, const bdd& f);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief The lexicographically largest x such that f(x) is true within the given domain.
   ///
@@ -2079,6 +2254,15 @@ namespace adiar
              const generator<bdd::label_type>& d,
              const size_t d_size = bdd::max_label + 1);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The lexicographically largest x such that f(x) is true within the given domain.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_satmax(const exec_policy& ep,
+             const bdd& f,
+             const generator<bdd::label_type>& d,
+             const size_t d_size = bdd::max_label + 1);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief The lexicographically largest x such that f(x) is true.
   ///
@@ -2118,6 +2302,12 @@ namespace adiar
   bdd
   bdd_satmax(const bdd& f, const bdd& d);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The lexicographically largest x such that f(x) is true.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_satmax(const exec_policy& ep, const bdd& f, const bdd& d);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief   The lexicographically largest x such that f(x) is true.
   ///
@@ -2149,6 +2339,85 @@ namespace adiar
     return iter;
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Enumerate all x such that f(x) is true.
+  ///
+  /// \details The paths to the true terminal are enumerated with a single depth-first traversal.
+  ///          Each path is provided as a cube, i.e. the variables that are skipped by the path are
+  ///          don't cares and not provided. The cubes are disjoint and are provided in
+  ///          lexicographical order.
+  ///
+  /// \param f
+  ///    BDD of interest.
+  ///
+  /// \param c
+  ///    Consumer that is called once per cube with a generator of its (var, value) pairs in
+  ///    ascending order of the bdd's levels. If `f` is the true terminal, then `c` is called once
+  ///    with an empty cube.
+  ///
+  /// \remark The generator is only valid until `c` returns.
+  ///
+  /// \remark If they fit, the nodes of `f` are loaded into internal memory. Otherwise, they are
+  ///         streamed from disk, where jumping back up to a node's high child may require the
+  ///         nodes to be read again from the start.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  bdd_satall(const bdd& f, const consumer<generator<pair<bdd::label_type, bool>>>& c);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Enumerate all x such that f(x) is true.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  bdd_satall(const exec_policy& ep,
+             const bdd& f,
+             const consumer<generator<pair<bdd::label_type, bool>>>& c);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Draw uniformly random satisfying assignments x such that f(x) is true.
+  ///
+  /// \details The number of satisfying assignments below each node is computed once with a
+  ///          bottom-up sweep. Then, all samples are drawn together in a single top-down sweep.
+  ///          This is much faster than drawing each sample on its own.
+  ///
+  /// \param f
+  ///    BDD of interest.
+  ///
+  /// \param samples
+  ///    Number of assignments to draw (with replacement).
+  ///
+  /// \param seed
+  ///    Seed for the pseudo-random number generator. The same seed provides the same samples.
+  ///
+  /// \param c
+  ///    Consumer that is called with the index of the sample (in `[0, samples)`) and a
+  ///    (var, value) pair of it. Each sample is provided in ascending order of the bdd's levels,
+  ///    but the calls for different samples are interleaved.
+  ///
+  /// \remark The assignments are uniform over the variables that `f` depends on, i.e. the levels
+  ///         of its nodes. Any other variable can be assigned freely. That is, if `f` is a
+  ///         terminal, then `c` is never called.
+  ///
+  /// \remark To not overflow, the number of assignments is approximated with a floating-point
+  ///         number. Hence, the distribution may slightly deviate from the uniform one.
+  ///
+  /// \throws invalid_argument If `f` is the false terminal and `samples > 0`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  bdd_satsample(const bdd& f,
+                size_t samples,
+                uint64_t seed,
+                const consumer<pair<size_t, pair<bdd::label_type, bool>>>& c);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Draw uniformly random satisfying assignments x such that f(x) is true.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  bdd_satsample(const exec_policy& ep,
+                const bdd& f,
+                size_t samples,
+                uint64_t seed,
+                const consumer<pair<size_t, pair<bdd::label_type, bool>>>& c);
+
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Obtain the satisfying assignment that is minimal for the given linear cost function
   ///        over the global domain.
@@ -2204,6 +2473,144 @@ namespace adiar
              const cost<bdd::label_type>& c,
              const consumer<pair<bdd::label_type, bool>>& cb);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Obtain the `k` satisfying assignments that are minimal for the given linear cost
+  ///          function over the global domain.
+  ///
+  /// \details Each solution is a distinct path to the true terminal, i.e. the cheapest assignment
+  ///          within each of `k` disjoint cubes. Variables that are not on a path are not part of
+  ///          its cube (and hence are not assigned any cost).
+  ///
+  /// \param f
+  ///    The BDD of feasible solutions
+  ///
+  /// \param c
+  ///    A (pure) function that provides the cost function's coefficient.
+  ///
+  /// \param k
+  ///    The (maximum) number of solutions to obtain.
+  ///
+  /// \returns The (up to) `k` cheapest cubes together with their cost in ascending order.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<pair<bdd, double>>
+  bdd_optmin(const bdd& f, const cost<bdd::label_type>& c, size_t k);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the `k` satisfying assignments that are minimal for the given linear cost
+  ///        function over the global domain.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<pair<bdd, double>>
+  bdd_optmin(const exec_policy& ep, const bdd& f, const cost<bdd::label_type>& c, size_t k);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the `k` satisfying assignments that are minimal for the given linear cost
+  ///        function over the global domain.
+  ///
+  /// \param f
+  ///    The BDD of feasible solutions
+  ///
+  /// \param c
+  ///    A (pure) function that provides the cost function's coefficient.
+  ///
+  /// \param k
+  ///    The (maximum) number of solutions to obtain.
+  ///
+  /// \param cb
+  ///    A callback function that is given the index of the solution together with each of its
+  ///    assignments. The assignments of each solution are provided in \em descending order.
+  ///
+  /// \returns The cost of each solution in ascending order, i.e. the `i`th value is the cost of
+  ///          the `i`th solution.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<double>
+  bdd_optmin(const bdd& f,
+             const cost<bdd::label_type>& c,
+             size_t k,
+             const consumer<pair<size_t, pair<bdd::label_type, bool>>>& cb);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the `k` satisfying assignments that are minimal for the given linear cost
+  ///        function over the global domain.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<double>
+  bdd_optmin(const exec_policy& ep,
+             const bdd& f,
+             const cost<bdd::label_type>& c,
+             size_t k,
+             const consumer<pair<size_t, pair<bdd::label_type, bool>>>& cb);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Obtain the `k` satisfying assignments that are lexicographically minimal for the
+  ///          given linear cost functions over the global domain.
+  ///
+  /// \details The first cost function is the primary objective, whereas each later one only breaks
+  ///          ties between solutions that are equally good for all prior ones.
+  ///
+  /// \param f
+  ///    The BDD of feasible solutions
+  ///
+  /// \param cs
+  ///    The (pure) cost functions in order of priority.
+  ///
+  /// \param k
+  ///    The (maximum) number of solutions to obtain.
+  ///
+  /// \returns The (up to) `k` cheapest cubes together with their cost vectors in ascending
+  ///          lexicographic order.
+  ///
+  /// \throws invalid_argument If there are no cost functions or more than 4 of them.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<pair<bdd, std::vector<double>>>
+  bdd_optmin(const bdd& f, const std::vector<cost<bdd::label_type>>& cs, size_t k = 1);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the `k` satisfying assignments that are lexicographically minimal for the
+  ///        given linear cost functions over the global domain.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<pair<bdd, std::vector<double>>>
+  bdd_optmin(const exec_policy& ep,
+             const bdd& f,
+             const std::vector<cost<bdd::label_type>>& cs,
+             size_t k = 1);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the `k` satisfying assignments that are lexicographically minimal for the
+  ///        given linear cost functions over the global domain.
+  ///
+  /// \param f
+  ///    The BDD of feasible solutions
+  ///
+  /// \param cs
+  ///    The (pure) cost functions in order of priority.
+  ///
+  /// \param k
+  ///    The (maximum) number of solutions to obtain.
+  ///
+  /// \param cb
+  ///    A callback function that is given the index of the solution together with each of its
+  ///    assignments. The assignments of each solution are provided in \em descending order.
+  ///
+  /// \returns The cost vector of each solution in ascending lexicographic order.
+  ///
+  /// \throws invalid_argument If there are no cost functions or more than 4 of them.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<std::vector<double>>
+  bdd_optmin(const bdd& f,
+             const std::vector<cost<bdd::label_type>>& cs,
+             size_t k,
+             const consumer<pair<size_t, pair<bdd::label_type, bool>>>& cb);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the `k` satisfying assignments that are lexicographically minimal for the
+  ///        given linear cost functions over the global domain.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<std::vector<double>>
+  bdd_optmin(const exec_policy& ep,
+             const bdd& f,
+             const std::vector<cost<bdd::label_type>>& cs,
+             size_t k,
+             const consumer<pair<size_t, pair<bdd::label_type, bool>>>& cb);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief   Evaluate a BDD according to an assignment to its variables.
   ///
@@ -2262,6 +2669,39 @@ namespace adiar
     return bdd_eval(f, make_generator(begin, end));
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Evaluate a BDD according to many assignments at once.
+  ///
+  /// \details All assignments are evaluated together in a single top-down sweep. The assignments
+  ///          are bit-packed in blocks of 64, i.e. the j'th bit of a word for block i is the value
+  ///          of the (64i + j)'th assignment. This way, all assignments of a block that reach the
+  ///          same node are moved onwards with a few bitwise operations.
+  ///
+  /// \param f
+  ///    The BDD to evaluate.
+  ///
+  /// \param n
+  ///    The number of assignments.
+  ///
+  /// \param xs
+  ///    A (pure) function that given a variable, x, and a block, i, provides the bit-packed values
+  ///    of x for the assignments in block i.
+  ///
+  /// \returns The bit-packed results in blocks of 64, i.e. the j'th bit of the i'th word is the
+  ///          result for the (64i + j)'th assignment. Bits beyond the n'th assignment are zero.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<uint64_t>
+  bdd_eval_batch(const bdd& f, size_t n, const function<uint64_t(bdd::label_type, size_t)>& xs);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Evaluate a BDD according to many assignments at once.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<uint64_t>
+  bdd_eval_batch(const exec_policy& ep,
+                 const bdd& f,
+                 size_t n,
+                 const function<uint64_t(bdd::label_type, size_t)>& xs);
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////////////////////////
 
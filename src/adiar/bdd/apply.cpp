@@ -155,6 +155,22 @@ namespace adiar
     return bdd_apply(exec_policy(), f, g, op);
   }
 
+  std::vector<__bdd>
+  bdd_apply(const exec_policy& ep,
+            const std::vector<bdd>& fs,
+            const bdd& g,
+            const predicate<bool, bool>& op)
+  {
+    const apply_prod2b_policy<internal::binary_op<predicate<bool, bool>>> policy(op);
+    return internal::prod2b_many(ep, fs, g, policy);
+  }
+
+  std::vector<__bdd>
+  bdd_apply(const std::vector<bdd>& fs, const bdd& g, const predicate<bool, bool>& op)
+  {
+    return bdd_apply(exec_policy(), fs, g, op);
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   __bdd
   bdd_and(const exec_policy& ep, const bdd& f, const bdd& g)
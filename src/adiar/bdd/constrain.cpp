@@ -0,0 +1,203 @@
+#include <adiar/bdd.h>
+#include <adiar/bdd/bdd_policy.h>
+#include <adiar/types.h>
+
+#include <adiar/internal/algorithms/prod2b.h>
+#include <adiar/internal/assert.h>
+#include <adiar/internal/cut.h>
+#include <adiar/internal/data_types/tuple.h>
+#include <adiar/internal/dd_func.h>
+#include <adiar/internal/io/levelized_ifstream.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Product Construction policy for Coudert and Madre's *constrain* and *restrict*.
+  ///
+  /// \details Both recurse on `f` and `c` together. Whenever one branch of `c` is `false`, the node
+  ///          is skipped in favour of the other branch.
+  ///
+  /// \tparam Simplify Whether to also skip the nodes of `c` on levels that `f` does not depend on
+  ///                  (if doing so is safe without computing the disjunction of its branches).
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <bool Simplify>
+  class constrain_prod2b_policy
+    : public bdd_policy
+    , public internal::prod2b_mixed_level_merger<bdd_policy>
+  {
+  private:
+    /// \brief Whether `f` and `c` have been swapped, i.e. whether `c` is the first argument.
+    bool _flipped = false;
+
+  public:
+    void
+    setup_next_level(const bdd::label_type /*next_level*/) const
+    {}
+
+  public:
+    /// \brief Swap the roles of both arguments.
+    void
+    flip()
+    {
+      this->_flipped = !this->_flipped;
+    }
+
+  public:
+    /// \brief Hook for case of two BDDs with the same node file.
+    __bdd
+    resolve_same_file(const bdd& f, const bdd& c) const
+    {
+      if (bdd_isterminal(f)) { return this->resolve_terminal_root(f, c); }
+
+      // f agrees with itself on all of c (and disagrees with its negation everywhere).
+      return bdd_terminal(f.is_negated() == c.is_negated());
+    }
+
+    /// \brief Hook for either of the two BDDs being a terminal.
+    __bdd
+    resolve_terminal_root(const bdd& f, const bdd& c) const
+    {
+      adiar_assert(bdd_isterminal(f) || bdd_isterminal(c));
+      adiar_assert(!this->_flipped, "Roots are resolved before any flipping");
+
+      if (bdd_isterminal(c) && !dd_valueof(c)) { return bdd_terminal(false); }
+      return f;
+    }
+
+  private:
+    /// \brief The recursion target within `f`.
+    const bdd::pointer_type&
+    __f(const internal::tuple<bdd::pointer_type>& r) const
+    {
+      return r[this->_flipped];
+    }
+
+    /// \brief The recursion target within `c`.
+    const bdd::pointer_type&
+    __c(const internal::tuple<bdd::pointer_type>& r) const
+    {
+      return r[!this->_flipped];
+    }
+
+    /// \brief Create a recursion target (in the order of the inputs).
+    internal::tuple<bdd::pointer_type>
+    __target(const bdd::pointer_type& f, const bdd::pointer_type& c) const
+    {
+      if (this->_flipped) { return { c, f }; }
+      return { f, c };
+    }
+
+    /// \brief Applies shortcutting on a recursion target, if possible.
+    internal::tuple<bdd::pointer_type>
+    __resolve_request(const internal::tuple<bdd::pointer_type>& r) const
+    {
+      adiar_assert(this->__c(r) != bdd::pointer_type(false), "Never recurse into the don't-cares");
+
+      // A terminal is already independent of `c`.
+      if (this->__f(r).is_terminal()) {
+        return this->__target(this->__f(r), bdd::pointer_type(true));
+      }
+      return r;
+    }
+
+  public:
+    /// \brief Hook for changing the targets of a new node's children.
+    internal::prod2b_rec
+    resolve_request(const internal::tuple<bdd::pointer_type>& r_low,
+                    const internal::tuple<bdd::pointer_type>& r_high) const
+    {
+      // Skip node, if only one of its branches is cared for.
+      if (this->__c(r_low) == bdd::pointer_type(false)) {
+        return internal::prod2b_rec_skipto(this->__resolve_request(r_high));
+      }
+      if (this->__c(r_high) == bdd::pointer_type(false)) {
+        return internal::prod2b_rec_skipto(this->__resolve_request(r_low));
+      }
+
+      if constexpr (Simplify) {
+        // If `f` does not depend on this level, then the care set should rather be the disjunction
+        // of both branches. We cannot compute it here; but, if either is `true`, then so is the
+        // disjunction.
+        const bool f_skips_level = this->__f(r_low) == this->__f(r_high);
+
+        if (f_skips_level
+            && (this->__c(r_low) == bdd::pointer_type(true)
+                || this->__c(r_high) == bdd::pointer_type(true))) {
+          return internal::prod2b_rec_skipto(
+            this->__resolve_request(this->__target(this->__f(r_low), bdd::pointer_type(true))));
+        }
+      }
+
+      return internal::prod2b_rec_output{ this->__resolve_request(r_low),
+                                          this->__resolve_request(r_high) };
+    }
+
+    /// \brief Hook for applying an operator to a pair of terminals.
+    bdd::pointer_type
+    operator()(const bdd::pointer_type& a, const bdd::pointer_type& b) const
+    {
+      return this->_flipped ? b : a;
+    }
+
+  public:
+    /// \brief Hook for deriving the cut type of the left-hand-side.
+    internal::cut
+    left_cut() const
+    {
+      return internal::cut(true, true);
+    }
+
+    /// \brief Hook for deriving the cut type of the right-hand-side.
+    internal::cut
+    right_cut() const
+    {
+      return internal::cut(false, true);
+    }
+
+    /// \brief Since the don't-cares are skipped, this policy may introduce skipping of nodes.
+    static constexpr bool no_skip = false;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_constrain(const exec_policy& ep, const bdd& f, const bdd& c)
+  {
+    constrain_prod2b_policy<false> policy;
+    return internal::prod2b(ep, f, c, policy);
+  }
+
+  __bdd
+  bdd_constrain(const bdd& f, const bdd& c)
+  {
+    return bdd_constrain(exec_policy(), f, c);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_simplify(const exec_policy& ep, const bdd& f, const bdd& care)
+  {
+    // Quantify all variables in the care set that are not in the support of f. Both level streams
+    // are read bottom-up, as the variables are to be provided in descending order.
+    internal::level_info_ifstream<true> f_levels(f);
+    internal::level_info_ifstream<true> care_levels(care);
+
+    const bdd care_f = bdd_exists(ep, care, [&]() -> optional<bdd::label_type> {
+      while (care_levels.can_pull()) {
+        const bdd::label_type x = care_levels.pull().label();
+
+        while (f_levels.can_pull() && x < f_levels.peek().label()) { f_levels.pull(); }
+        if (!f_levels.can_pull() || f_levels.peek().label() != x) { return x; }
+      }
+      return make_optional<bdd::label_type>();
+    });
+
+    constrain_prod2b_policy<true> policy;
+    return internal::prod2b(ep, f, care_f, policy);
+  }
+
+  __bdd
+  bdd_simplify(const bdd& f, const bdd& care)
+  {
+    return bdd_simplify(exec_policy(), f, care);
+  }
+}
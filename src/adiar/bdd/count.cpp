@@ -1,13 +1,21 @@
+#include <algorithm>
+#include <cmath>
 #include <stdint.h>
 
+#include <tpie/array.h>
+
 #include <adiar/bdd.h>
 #include <adiar/bdd/bdd_policy.h>
 #include <adiar/domain.h>
 #include <adiar/exception.h>
 
 #include <adiar/internal/algorithms/count.h>
+#include <adiar/internal/algorithms/sample.h>
 #include <adiar/internal/assert.h>
 #include <adiar/internal/dd_func.h>
+#include <adiar/internal/io/file.h>
+#include <adiar/internal/io/ifstream.h>
+#include <adiar/internal/io/levelized_ifstream.h>
 
 namespace adiar
 {
@@ -35,7 +43,8 @@ namespace adiar
   class sat_count_policy : public bdd_policy
   {
   public:
-    using data_type = sat_data;
+    using data_type   = sat_data;
+    using result_type = uint64_t;
 
     static constexpr data_type init_data = { 1u, 0u };
 
@@ -72,6 +81,187 @@ namespace adiar
     {
       return { acc.sum, acc.levels_visited + 1u };
     }
+
+    static inline data_type
+    forward(const data_type& d, const bdd::node_type& /*n*/, const bool /*arc*/)
+    {
+      return d;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Weighted Model Count Policy
+  struct wmc_data
+  {
+    static constexpr bool sort_on_tiebreak = false;
+    static constexpr bool has_level        = false;
+
+    /// Weighted sum of all assignments to the levels above the target
+    double sum;
+  };
+
+  class wmc_policy : public bdd_policy
+  {
+  public:
+    using data_type   = wmc_data;
+    using result_type = double;
+
+  private:
+    /// Variables of the domain (in ascending order)
+    tpie::array<bdd::label_type> _vars;
+
+    /// Number of variables in the domain (the above array may be larger)
+    size_t _varcount = 0u;
+
+    /// Weight of each variable's negative and positive literal
+    tpie::array<double> _weights[2];
+
+    /// Product of the weights of skipping each of the first i variables (ignoring the ones that are
+    /// zero). To neither under- nor overflow, the product is split into its mantissa and exponent.
+    tpie::array<double> _skip_mantissa;
+
+    /// \copydoc _skip_mantissa
+    tpie::array<int> _skip_exponent;
+
+    /// Number of the first i variables whose weight of being skipped is zero.
+    tpie::array<size_t> _skip_zeros;
+
+  public:
+    /// Initial value for the root (including the levels skipped above it)
+    data_type init_data = { 1.0 };
+
+  public:
+    wmc_policy(const bdd& f, const weight<bdd::label_type>& w)
+    {
+      // Obtain variables of the domain and of the BDD (in ascending order)
+      {
+        const internal::shared_file<bdd::label_type> dom =
+          domain_isset() ? domain_get() : internal::shared_file<bdd::label_type>();
+
+        _vars.resize(dom->size() + bdd_varcount(f));
+
+        internal::ifstream<bdd::label_type> ds(dom);
+        internal::level_info_ifstream<> fs(f);
+
+        while (ds.can_pull() || fs.can_pull()) {
+          const bool from_domain =
+            !fs.can_pull() || (ds.can_pull() && ds.peek() < fs.peek().level());
+          const bdd::label_type x = from_domain ? ds.peek() : fs.peek().level();
+
+          if (ds.can_pull() && ds.peek() == x) { ds.pull(); }
+          if (fs.can_pull() && fs.peek().level() == x) { fs.pull(); }
+
+          _vars[_varcount++] = x;
+        }
+      }
+
+      // Obtain weights (and their prefix products)
+      const size_t varcount = _varcount;
+
+      _weights[false].resize(varcount);
+      _weights[true].resize(varcount);
+
+      _skip_mantissa.resize(varcount + 1u);
+      _skip_exponent.resize(varcount + 1u);
+      _skip_zeros.resize(varcount + 1u);
+
+      _skip_mantissa[0] = 1.0;
+      _skip_exponent[0] = 0;
+      _skip_zeros[0]    = 0u;
+
+      for (size_t i = 0u; i < varcount; ++i) {
+        _weights[false][i] = w(_vars[i], false);
+        _weights[true][i]  = w(_vars[i], true);
+
+        const double skip_weight = _weights[false][i] + _weights[true][i];
+
+        if (skip_weight == 0.0) {
+          _skip_mantissa[i + 1u] = _skip_mantissa[i];
+          _skip_exponent[i + 1u] = _skip_exponent[i];
+          _skip_zeros[i + 1u]    = _skip_zeros[i] + 1u;
+        } else {
+          int w_exponent;
+          const double w_mantissa = std::frexp(skip_weight, &w_exponent);
+
+          int p_exponent;
+          _skip_mantissa[i + 1u] = std::frexp(_skip_mantissa[i] * w_mantissa, &p_exponent);
+          _skip_exponent[i + 1u] = _skip_exponent[i] + w_exponent + p_exponent;
+          _skip_zeros[i + 1u]    = _skip_zeros[i];
+        }
+      }
+
+      // Weigh in the levels above the root
+      if (!bdd_isterminal(f)) { init_data = { skip(0u, idx_of(bdd_topvar(f))) }; }
+    }
+
+  public:
+    /// Number of variables in the domain
+    size_t
+    varcount() const
+    {
+      return _varcount;
+    }
+
+  private:
+    /// Index of a variable within the domain
+    size_t
+    idx_of(const bdd::label_type x) const
+    {
+      const auto end = _vars.begin() + _varcount;
+      const auto it  = std::lower_bound(_vars.begin(), end, x);
+      adiar_assert(it != end && *it == x, "Variable should be in the domain");
+      return std::distance(_vars.begin(), it);
+    }
+
+  public:
+    /// Weight of skipping all variables in the interval [begin, end) of the domain
+    double
+    skip(const size_t begin, const size_t end) const
+    {
+      adiar_assert(begin <= end && end <= _varcount);
+
+      // Any variable with a weight of zero zeroes out the entire product.
+      if (_skip_zeros[begin] != _skip_zeros[end]) { return 0.0; }
+
+      return std::ldexp(_skip_mantissa[end] / _skip_mantissa[begin],
+                        _skip_exponent[end] - _skip_exponent[begin]);
+    }
+
+  public:
+    static constexpr double
+    resolve_false(const data_type& /*d*/, const typename bdd::label_type /*varcount*/)
+    {
+      return 0.0;
+    }
+
+    static inline double
+    resolve_true(const data_type& d, const typename bdd::label_type /*varcount*/)
+    {
+      return d.sum;
+    }
+
+    static inline data_type
+    merge(const data_type&& acc, const data_type& next)
+    {
+      return { acc.sum + next.sum };
+    }
+
+    static inline data_type
+    merge_end(const data_type&& acc)
+    {
+      return acc;
+    }
+
+    inline data_type
+    forward(const data_type& d, const bdd::node_type& n, const bool arc) const
+    {
+      const size_t n_idx = idx_of(n.label());
+
+      const bdd::pointer_type child = n.child(arc);
+      const size_t child_idx        = child.is_terminal() ? _varcount : idx_of(child.label());
+
+      return { d.sum * _weights[arc][n_idx] * skip(n_idx + 1u, child_idx) };
+    }
   };
 
   //////////////////////////////////////////////////////////////////////////////
@@ -130,4 +320,46 @@ namespace adiar
   {
     return bdd_satcount(exec_policy(), f);
   };
+
+  void
+  bdd_satsample(const exec_policy& ep,
+                const bdd& f,
+                size_t samples,
+                uint64_t seed,
+                const consumer<pair<size_t, pair<bdd::label_type, bool>>>& c)
+  {
+    if (bdd_isterminal(f)) {
+      if (!dd_valueof(f) && samples > 0u) {
+        throw invalid_argument("Cannot sample from an unsatisfiable BDD");
+      }
+      return;
+    }
+
+    internal::sample<bdd_policy>(ep, f, samples, seed, c);
+  }
+
+  void
+  bdd_satsample(const bdd& f,
+                size_t samples,
+                uint64_t seed,
+                const consumer<pair<size_t, pair<bdd::label_type, bool>>>& c)
+  {
+    bdd_satsample(exec_policy(), f, samples, seed, c);
+  }
+
+  double
+  bdd_wmc(const exec_policy& ep, const bdd& f, const weight<bdd::label_type>& w)
+  {
+    const wmc_policy policy(f, w);
+
+    if (bdd_isterminal(f)) { return dd_valueof(f) ? policy.skip(0u, policy.varcount()) : 0.0; }
+
+    return internal::count(ep, policy, f, bdd_varcount(f));
+  }
+
+  double
+  bdd_wmc(const bdd& f, const weight<bdd::label_type>& w)
+  {
+    return bdd_wmc(exec_policy(), f, w);
+  }
 }
@@ -3,15 +3,19 @@
 #include <adiar/functional.h>
 #include <tpie/tpie.h>
 
+#include <adiar/internal/algorithms/count.h>
 #include <adiar/internal/algorithms/traverse.h>
 #include <adiar/internal/assert.h>
 #include <adiar/internal/cut.h>
+#include <adiar/internal/data_structures/levelized_priority_queue.h>
 #include <adiar/internal/data_structures/stack.h>
 #include <adiar/internal/data_types/level_info.h>
 #include <adiar/internal/io/ifstream.h>
 #include <adiar/internal/io/levelized_ifstream.h>
+#include <adiar/internal/io/node_ifstream.h>
 #include <adiar/internal/io/node_ofstream.h>
 #include <adiar/internal/io/ofstream.h>
+#include <adiar/internal/memory.h>
 #include <adiar/internal/util.h>
 
 namespace adiar
@@ -119,22 +123,196 @@ namespace adiar
     return v.get_result();
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  struct eval_batch_data
+  {
+    static constexpr bool sort_on_tiebreak = true;
+    static constexpr bool has_level        = false;
+
+    /// Index of the block of 64 assignments
+    size_t block;
+
+    /// Assignments within the block that reach the target
+    uint64_t lanes;
+
+    /// Sorting predicate (to group all requests for the same block)
+    inline bool
+    operator<(const eval_batch_data& o) const
+    {
+      return this->block < o.block;
+    }
+  };
+
+  template <size_t look_ahead, internal::memory_mode mem_mode>
+  using eval_batch_priority_queue_t =
+    internal::count_priority_queue_t<eval_batch_data, look_ahead, mem_mode>;
+
+  /// \brief The lanes of a block that are in use, i.e. that are less than `n`.
+  inline uint64_t
+  __bdd_eval_batch_lanes(const size_t n, const size_t block)
+  {
+    const size_t block_size = std::min<size_t>(64u, n - 64u * block);
+    return block_size == 64u ? ~uint64_t(0u) : (uint64_t(1u) << block_size) - 1u;
+  }
+
+  template <typename PriorityQueue>
+  inline void
+  __bdd_eval_batch_resolve(PriorityQueue& pq,
+                           internal::memory_vector<uint64_t>& out,
+                           const bdd::pointer_type& target,
+                           const eval_batch_data& data)
+  {
+    if (data.lanes == 0u) { return; }
+
+    if (target.is_terminal()) {
+      if (target.value()) { out[data.block] |= data.lanes; }
+    } else {
+      pq.push({ { target }, {}, data });
+    }
+  }
+
+  template <typename PriorityQueue>
+  void
+  __bdd_eval_batch(const bdd& f,
+                   const size_t assignments,
+                   const function<uint64_t(bdd::label_type, size_t)>& xs,
+                   internal::memory_vector<uint64_t>& out,
+                   const size_t pq_max_memory,
+                   const size_t pq_max_size)
+  {
+    internal::node_ifstream<> ns(f);
+
+    // Set up cross-level priority queue with a request for the root per block
+    PriorityQueue pq({ f }, pq_max_memory, pq_max_size, internal::stats_count.lpq);
+    {
+      const bdd::node_type root = ns.peek();
+
+      for (size_t b = 0u; b < out.size(); ++b) {
+        pq.push({ { root.uid() }, {}, { b, __bdd_eval_batch_lanes(assignments, b) } });
+      }
+    }
+
+    while (!pq.empty()) {
+      pq.setup_next_level();
+
+      while (!pq.empty_level()) {
+        // Skip nodes not reached by any assignment
+        bdd::node_type n = ns.pull();
+        while (n.uid() < pq.top().target.first()) { n = ns.pull(); }
+
+        while (pq.can_pull() && pq.top().target == n.uid()) {
+          eval_batch_data data = pq.pull().data;
+
+          // Combine all requests for the same block
+          while (pq.can_pull() && pq.top().target == n.uid() && pq.top().data.block == data.block) {
+            data.lanes |= pq.pull().data.lanes;
+          }
+
+          const uint64_t values = xs(n.label(), data.block);
+
+          __bdd_eval_batch_resolve(pq, out, n.low(), { data.block, data.lanes & ~values });
+          __bdd_eval_batch_resolve(pq, out, n.high(), { data.block, data.lanes & values });
+        }
+      }
+    }
+  }
+
+  std::vector<uint64_t>
+  bdd_eval_batch(const exec_policy& ep,
+                 const bdd& f,
+                 size_t n,
+                 const function<uint64_t(bdd::label_type, size_t)>& xs)
+  {
+    const size_t blocks = (n + 63u) / 64u;
+
+    if (n == 0u) { return {}; }
+
+    if (bdd_isterminal(f)) {
+      std::vector<uint64_t> out(blocks, 0u);
+      if (bdd_istrue(f)) {
+        for (size_t b = 0u; b < blocks; ++b) { out[b] = __bdd_eval_batch_lanes(n, b); }
+      }
+      return out;
+    }
+
+    // The result is accumulated in accounted memory, such that it is excluded from the memory
+    // available to the priority queue.
+    internal::memory_vector<uint64_t> out(blocks, 0u);
+
+    // Compute amount of memory available for auxiliary data structures after having opened all
+    // streams.
+    const size_t aux_available_memory =
+      internal::memory_available() - internal::node_ifstream<>::memory_usage();
+
+    using internal_pq_t =
+      eval_batch_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, internal::memory_mode::Internal>;
+
+    const size_t pq_memory_fits = internal_pq_t::memory_fits(aux_available_memory);
+
+    const bool internal_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
+    const bool external_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::External;
+
+    // Each block may have a request on every arc crossing a level.
+    const size_t pq_bound = f.max_2level_cut(internal::cut::Internal) * blocks;
+
+    const size_t max_pq_size = internal_only ? std::min(pq_memory_fits, pq_bound) : pq_bound;
+
+    if (!external_only && max_pq_size <= internal::no_lookahead_bound()) {
+#ifdef ADIAR_STATS
+      internal::stats_count.lpq.unbucketed += 1u;
+#endif
+      __bdd_eval_batch<eval_batch_priority_queue_t<0, internal::memory_mode::Internal>>(
+        f, n, xs, out, aux_available_memory, max_pq_size);
+    } else if (!external_only && max_pq_size <= pq_memory_fits) {
+#ifdef ADIAR_STATS
+      internal::stats_count.lpq.internal += 1u;
+#endif
+      __bdd_eval_batch<internal_pq_t>(f, n, xs, out, aux_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      internal::stats_count.lpq.hybrid += 1u;
+#endif
+      __bdd_eval_batch<
+        eval_batch_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, internal::memory_mode::Hybrid>>(
+        f, n, xs, out, aux_available_memory, max_pq_size);
+    } else {
+#ifdef ADIAR_STATS
+      internal::stats_count.lpq.external += 1u;
+#endif
+      __bdd_eval_batch<
+        eval_batch_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, internal::memory_mode::External>>(
+        f, n, xs, out, aux_available_memory, max_pq_size);
+    }
+
+    return std::vector<uint64_t>(out.begin(), out.end());
+  }
+
+  std::vector<uint64_t>
+  bdd_eval_batch(const bdd& f, size_t n, const function<uint64_t(bdd::label_type, size_t)>& xs)
+  {
+    return bdd_eval_batch(exec_policy(), f, n, xs);
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // TODO: Merge code duplication with Curiously Recurring Template Pattern
 
-  template <typename Visitor>
+  template <typename Visitor, internal::memory_mode StackMode>
   class bdd_satX__stack
   {
+  public:
+    using value_type = pair<bdd::label_type, bool>;
+    using stack_type = internal::stack<StackMode, value_type>;
+
   private:
     Visitor _visitor;
 
     const generator<bdd::label_type>& _generator;
     optional<bdd::label_type> _next_domain;
 
-    // Reserve an internal memory vector (of up to 8 MiB) for the result.
-    // TODO: Abstract the stack into <adiar/internal/data_structures/stack.h>.
-    using value_type = pair<bdd::label_type, bool>;
-    internal::stack<internal::memory_mode::Internal, value_type> _stack;
+    // Stack (of up to one element per level) for the result.
+    stack_type _stack;
 
   public:
     bdd_satX__stack(const generator<bdd::label_type>& g, const size_t stack_size)
@@ -217,13 +395,11 @@ namespace adiar
     }
   };
 
-  template <typename Visitor>
+  template <typename Visitor, internal::memory_mode StackMode>
   bdd
   __bdd_satX(const bdd& f, const generator<bdd::label_type>& dom, const size_t levels)
   {
-    if (bdd_isfalse(f)) { return f; }
-
-    bdd_satX__stack<Visitor> v(dom, levels);
+    bdd_satX__stack<Visitor, StackMode> v(dom, levels);
     internal::traverse(f, v);
 
     return v.build_bdd();
@@ -231,12 +407,41 @@ namespace adiar
 
   template <typename Visitor>
   bdd
-  __bdd_satX(const bdd& f)
+  __bdd_satX(const exec_policy& ep,
+             const bdd& f,
+             const generator<bdd::label_type>& dom,
+             const size_t levels)
+  {
+    if (bdd_isfalse(f)) { return f; }
+
+    // Use an internal memory stack if it fits next to the input stream of the traversal.
+    const size_t aux_available_memory =
+      internal::memory_available() - internal::node_ifstream<>::memory_usage();
+
+    using internal_stack_t =
+      typename bdd_satX__stack<Visitor, internal::memory_mode::Internal>::stack_type;
+
+    const bool internal_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
+    const bool external_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::External;
+
+    if (internal_only
+        || (!external_only && internal_stack_t::memory_usage(levels) <= aux_available_memory)) {
+      return __bdd_satX<Visitor, internal::memory_mode::Internal>(f, dom, levels);
+    } else {
+      return __bdd_satX<Visitor, internal::memory_mode::External>(f, dom, levels);
+    }
+  }
+
+  template <typename Visitor>
+  bdd
+  __bdd_satX(const exec_policy& ep, const bdd& f)
   {
     if (bdd_istrue(f)) { return f; }
 
     const generator<bdd::label_type> nothing = []() -> optional<bdd::label_type> { return {}; };
-    return __bdd_satX<Visitor>(f, nothing, f->levels());
+    return __bdd_satX<Visitor>(ep, f, nothing, f->levels());
   }
 
   template <typename Visitor>
@@ -249,21 +454,36 @@ namespace adiar
     internal::traverse(f, v);
   }
 
+  bdd
+  bdd_satmin(const exec_policy& ep, const bdd& f)
+  {
+    return __bdd_satX<internal::traverse_satmin_visitor>(ep, f);
+  }
+
   bdd
   bdd_satmin(const bdd& f)
   {
-    return __bdd_satX<internal::traverse_satmin_visitor>(f);
+    return bdd_satmin(exec_policy(), f);
   }
 
   bdd
-  bdd_satmin(const bdd& f, const generator<bdd::label_type>& d, const size_t d_levels)
+  bdd_satmin(const exec_policy& ep,
+             const bdd& f,
+             const generator<bdd::label_type>& d,
+             const size_t d_levels)
   {
     const size_t total_levels = std::min<size_t>(f->levels() + d_levels, bdd::max_label + 1);
-    return __bdd_satX<internal::traverse_satmin_visitor>(f, d, total_levels);
+    return __bdd_satX<internal::traverse_satmin_visitor>(ep, f, d, total_levels);
   }
 
   bdd
-  bdd_satmin(const bdd& f, const bdd& d)
+  bdd_satmin(const bdd& f, const generator<bdd::label_type>& d, const size_t d_levels)
+  {
+    return bdd_satmin(exec_policy(), f, d, d_levels);
+  }
+
+  bdd
+  bdd_satmin(const exec_policy& ep, const bdd& f, const bdd& d)
   {
     if (!bdd_iscube(d)) { throw domain_error("BDD 'd' is not a cube"); }
 
@@ -272,7 +492,13 @@ namespace adiar
 
     const size_t total_levels = std::min<size_t>(f->levels() + d->levels(), bdd::max_label + 1);
 
-    return __bdd_satX<internal::traverse_satmin_visitor>(f, d_gen, total_levels);
+    return __bdd_satX<internal::traverse_satmin_visitor>(ep, f, d_gen, total_levels);
+  }
+
+  bdd
+  bdd_satmin(const bdd& f, const bdd& d)
+  {
+    return bdd_satmin(exec_policy(), f, d);
   }
 
   void
@@ -281,21 +507,36 @@ namespace adiar
     return __bdd_satX<internal::traverse_satmin_visitor>(f, c);
   }
 
+  bdd
+  bdd_satmax(const exec_policy& ep, const bdd& f)
+  {
+    return __bdd_satX<internal::traverse_satmax_visitor>(ep, f);
+  }
+
   bdd
   bdd_satmax(const bdd& f)
   {
-    return __bdd_satX<internal::traverse_satmax_visitor>(f);
+    return bdd_satmax(exec_policy(), f);
   }
 
   bdd
-  bdd_satmax(const bdd& f, const generator<bdd::label_type>& d, const size_t d_levels)
+  bdd_satmax(const exec_policy& ep,
+             const bdd& f,
+             const generator<bdd::label_type>& d,
+             const size_t d_levels)
   {
     const size_t total_levels = std::min<size_t>(f->levels() + d_levels, bdd::max_label + 1);
-    return __bdd_satX<internal::traverse_satmax_visitor>(f, d, total_levels);
+    return __bdd_satX<internal::traverse_satmax_visitor>(ep, f, d, total_levels);
   }
 
   bdd
-  bdd_satmax(const bdd& f, const bdd& d)
+  bdd_satmax(const bdd& f, const generator<bdd::label_type>& d, const size_t d_levels)
+  {
+    return bdd_satmax(exec_policy(), f, d, d_levels);
+  }
+
+  bdd
+  bdd_satmax(const exec_policy& ep, const bdd& f, const bdd& d)
   {
     if (!bdd_iscube(d)) { throw domain_error("BDD 'd' is not a cube"); }
 
@@ -304,7 +545,13 @@ namespace adiar
 
     const size_t total_levels = std::min<size_t>(f->levels() + d->levels(), bdd::max_label + 1);
 
-    return __bdd_satX<internal::traverse_satmax_visitor>(f, d_gen, total_levels);
+    return __bdd_satX<internal::traverse_satmax_visitor>(ep, f, d_gen, total_levels);
+  }
+
+  bdd
+  bdd_satmax(const bdd& f, const bdd& d)
+  {
+    return bdd_satmax(exec_policy(), f, d);
   }
 
   void
@@ -312,4 +559,31 @@ namespace adiar
   {
     return __bdd_satX<internal::traverse_satmax_visitor>(f, c);
   }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  bdd_satall(const exec_policy& ep,
+             const bdd& f,
+             const consumer<generator<pair<bdd::label_type, bool>>>& c)
+  {
+    using value_type = pair<bdd::label_type, bool>;
+
+    if (bdd_isterminal(f)) {
+      if (bdd_istrue(f)) { c([]() { return make_optional<value_type>(); }); }
+      return;
+    }
+
+    internal::traverse_paths(ep, f, [&c](const value_type* path, const size_t length) {
+      c([path, length, i = size_t(0u)]() mutable {
+        if (i == length) { return make_optional<value_type>(); }
+        return make_optional<value_type>(path[i++]);
+      });
+    });
+  }
+
+  void
+  bdd_satall(const bdd& f, const consumer<generator<pair<bdd::label_type, bool>>>& c)
+  {
+    return bdd_satall(exec_policy(), f, c);
+  }
 }
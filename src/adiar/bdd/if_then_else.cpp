@@ -635,6 +635,29 @@ namespace adiar
                                                                           pq_3_internal_memory,
                                                                           max_pq_3_size);
 
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_prod3.lpq.hybrid += 1u;
+#endif
+      using PriorityQueue_1 =
+        ite_priority_queue_1_t<ADIAR_LPQ_LOOKAHEAD, internal::memory_mode::Hybrid>;
+      using PriorityQueue_2 = ite_priority_queue_2_t<internal::memory_mode::Hybrid>;
+      using PriorityQueue_3 = ite_priority_queue_3_t<internal::memory_mode::Hybrid>;
+
+      const size_t pq_1_memory = aux_available_memory / 3;
+      const size_t pq_2_memory = pq_1_memory;
+      const size_t pq_3_memory = pq_1_memory;
+
+      return __bdd_ite<PriorityQueue_1, PriorityQueue_2, PriorityQueue_3>(ep,
+                                                                          f,
+                                                                          g,
+                                                                          h,
+                                                                          pq_1_memory,
+                                                                          max_pq_1_size,
+                                                                          pq_2_memory,
+                                                                          max_pq_2_size,
+                                                                          pq_3_memory,
+                                                                          max_pq_3_size);
     } else {
 #ifdef ADIAR_STATS
       stats_prod3.lpq.external += 1u;
@@ -4,22 +4,19 @@
 #include "adiar/internal/io/node_ofstream.h"
 #include "adiar/internal/io/shared_file_ptr.h"
 #include "adiar/types.h"
+#include <array>
+#include <vector>
 
 #include <adiar/bdd.h>
 #include <adiar/bdd/bdd_policy.h>
+#include <adiar/exception.h>
 
 #include <adiar/internal/algorithms/optmin.h>
+#include <adiar/internal/unreachable.h>
 
 namespace adiar
 {
 
-  // TODO: Allow for a tiebreak on multiple equally costly paths? This could allow for prioritizing
-  // fx the solution with fewest valiables set. It is not obvious whether there are cases of this
-  // which couldn't be accomplished by modifying the costs of the nodes. It is also not obvious
-  // what the interface should look like.
-  //
-  // Maybe this should be compatible with bullying, in which case bullying needs to not bully
-  // requests which are equally good as our current min.
   class bdd_optmin_policy : public bdd_policy
   {
   public:
@@ -102,4 +99,200 @@ namespace adiar
   {
     return bdd_optmin(exec_policy(), f, c);
   }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // K-Best and Lexicographic OptMin
+  template <size_t Objectives>
+  class bdd_optmin_k_policy : public bdd_policy
+  {
+  public:
+    static constexpr bool bullying     = true;
+    static constexpr size_t objectives = Objectives;
+
+    using cost_type = internal::optmin_cost<Objectives>;
+
+    void
+    out(size_t i, bdd::label_type label, bool value)
+    {
+      this->out_fn({ i, { label, value } });
+    }
+
+    cost_type
+    cost_fn(bdd::label_type label)
+    {
+      cost_type res;
+      for (size_t i = 0; i < Objectives; ++i) {
+        res[i] = this->get_costs[i](label);
+        if (res[i] < 0.0) {
+          throw adiar::domain_error("BDDs does not support negative cost functions");
+        }
+      }
+      return res;
+    }
+
+    bdd_optmin_k_policy(const consumer<pair<size_t, pair<bdd::label_type, bool>>>& o,
+                        const cost<bdd::label_type>* cs)
+      : out_fn(o)
+      , get_costs(cs)
+    {}
+
+  private:
+    const consumer<pair<size_t, pair<bdd::label_type, bool>>>& out_fn;
+    const cost<bdd::label_type>* get_costs;
+  };
+
+  /// \brief Maximum number of objectives for a lexicographic cost.
+  constexpr size_t bdd_optmin_max_objectives = 4u;
+
+  template <size_t Objectives>
+  std::vector<std::vector<double>>
+  __bdd_optmin_k(const exec_policy& ep,
+                 const bdd& f,
+                 const cost<bdd::label_type>* cs,
+                 size_t k,
+                 const consumer<pair<size_t, pair<bdd::label_type, bool>>>& cb)
+  {
+    bdd_optmin_k_policy<Objectives> omp(cb, cs);
+    const std::vector<internal::optmin_cost<Objectives>> costs = internal::optmin_k(ep, omp, f, k);
+
+    std::vector<std::vector<double>> res;
+    res.reserve(costs.size());
+    for (const internal::optmin_cost<Objectives>& oc : costs) {
+      res.push_back(std::vector<double>(oc.begin(), oc.end()));
+    }
+    return res;
+  }
+
+  /// \brief Materialize each solution of the callback variant as a cube.
+  template <typename Cost, typename OptMin>
+  std::vector<pair<bdd, Cost>>
+  __bdd_optmin_k_cubes(const bdd& f, const OptMin& optmin)
+  {
+    if (f->is_terminal()) {
+      // As f is already the cube we want to return, we'll just return that
+      const std::vector<Cost> costs = optmin([](pair<size_t, pair<bdd::label_type, bool>>) {});
+
+      std::vector<pair<bdd, Cost>> res;
+      for (const Cost& c : costs) { res.push_back({ f, c }); }
+      return res;
+    }
+
+    // The assignments of each solution are provided in descending order, i.e. in the order they
+    // need to be pushed to each cube's node file.
+    std::vector<std::vector<pair<bdd::label_type, bool>>> assignments;
+
+    const std::vector<Cost> costs =
+      optmin([&assignments](pair<size_t, pair<bdd::label_type, bool>> xv) {
+        if (assignments.size() <= xv.first) { assignments.resize(xv.first + 1); }
+        assignments[xv.first].push_back(xv.second);
+      });
+
+    std::vector<pair<bdd, Cost>> res;
+    res.reserve(costs.size());
+
+    for (size_t i = 0; i < costs.size(); ++i) {
+      bdd::shared_node_file_type nf;
+      {
+        internal::node_ofstream nw(nf);
+        bdd::pointer_type root = bdd::pointer_type(true);
+
+        for (const pair<bdd::label_type, bool>& xv : assignments[i]) {
+          const bdd::node_type next(xv.first,
+                                    bdd::max_id,
+                                    xv.second ? bdd::pointer_type(false) : root,
+                                    xv.second ? root : bdd::pointer_type(false));
+          nw << next;
+          root = next.uid();
+        }
+      }
+      res.push_back({ nf, costs[i] });
+    }
+    return res;
+  }
+
+  std::vector<std::vector<double>>
+  bdd_optmin(const exec_policy& ep,
+             const bdd& f,
+             const std::vector<cost<bdd::label_type>>& cs,
+             size_t k,
+             const consumer<pair<size_t, pair<bdd::label_type, bool>>>& cb)
+  {
+    if (cs.empty() || bdd_optmin_max_objectives < cs.size()) {
+      throw invalid_argument("Number of cost functions must be between 1 and 4");
+    }
+
+    switch (cs.size()) {
+    case 1u: return __bdd_optmin_k<1u>(ep, f, cs.data(), k, cb);
+    case 2u: return __bdd_optmin_k<2u>(ep, f, cs.data(), k, cb);
+    case 3u: return __bdd_optmin_k<3u>(ep, f, cs.data(), k, cb);
+    case 4u: return __bdd_optmin_k<4u>(ep, f, cs.data(), k, cb);
+    }
+    adiar_unreachable(); // LCOV_EXCL_LINE
+  }
+
+  std::vector<std::vector<double>>
+  bdd_optmin(const bdd& f,
+             const std::vector<cost<bdd::label_type>>& cs,
+             size_t k,
+             const consumer<pair<size_t, pair<bdd::label_type, bool>>>& cb)
+  {
+    return bdd_optmin(exec_policy(), f, cs, k, cb);
+  }
+
+  std::vector<pair<bdd, std::vector<double>>>
+  bdd_optmin(const exec_policy& ep,
+             const bdd& f,
+             const std::vector<cost<bdd::label_type>>& cs,
+             size_t k)
+  {
+    return __bdd_optmin_k_cubes<std::vector<double>>(
+      f, [&](const consumer<pair<size_t, pair<bdd::label_type, bool>>>& cb) {
+        return bdd_optmin(ep, f, cs, k, cb);
+      });
+  }
+
+  std::vector<pair<bdd, std::vector<double>>>
+  bdd_optmin(const bdd& f, const std::vector<cost<bdd::label_type>>& cs, size_t k)
+  {
+    return bdd_optmin(exec_policy(), f, cs, k);
+  }
+
+  std::vector<double>
+  bdd_optmin(const exec_policy& ep,
+             const bdd& f,
+             const cost<bdd::label_type>& c,
+             size_t k,
+             const consumer<pair<size_t, pair<bdd::label_type, bool>>>& cb)
+  {
+    const std::vector<std::vector<double>> costs = __bdd_optmin_k<1u>(ep, f, &c, k, cb);
+
+    std::vector<double> res;
+    res.reserve(costs.size());
+    for (const std::vector<double>& oc : costs) { res.push_back(oc[0]); }
+    return res;
+  }
+
+  std::vector<double>
+  bdd_optmin(const bdd& f,
+             const cost<bdd::label_type>& c,
+             size_t k,
+             const consumer<pair<size_t, pair<bdd::label_type, bool>>>& cb)
+  {
+    return bdd_optmin(exec_policy(), f, c, k, cb);
+  }
+
+  std::vector<pair<bdd, double>>
+  bdd_optmin(const exec_policy& ep, const bdd& f, const cost<bdd::label_type>& c, size_t k)
+  {
+    return __bdd_optmin_k_cubes<double>(
+      f, [&](const consumer<pair<size_t, pair<bdd::label_type, bool>>>& cb) {
+        return bdd_optmin(ep, f, c, k, cb);
+      });
+  }
+
+  std::vector<pair<bdd, double>>
+  bdd_optmin(const bdd& f, const cost<bdd::label_type>& c, size_t k)
+  {
+    return bdd_optmin(exec_policy(), f, c, k);
+  }
 } // namespace adiar
@@ -1,3 +1,5 @@
+#include <vector>
+
 #include <adiar/bdd.h>
 #include <adiar/bdd/bdd_policy.h>
 #include <adiar/types.h>
@@ -105,6 +107,88 @@ namespace adiar
     return bdd_restrict(exec_policy(), f, xs);
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  // Variant: Multi-root Restrict
+  class restrict_vector_mgr
+  {
+    assignment _current = assignment::None;
+
+    const std::vector<pair<bdd::label_type, bool>>& _xs;
+    size_t _idx = 0u;
+
+  public:
+    restrict_vector_mgr(const std::vector<pair<bdd::label_type, bool>>& xs)
+      : _xs(xs)
+    {}
+
+    bool
+    empty() const
+    {
+      return _xs.empty();
+    }
+
+    void
+    reset()
+    {
+      _current = assignment::None;
+      _idx     = 0u;
+    }
+
+    void
+    setup_level(bdd::label_type level)
+    {
+      while (_idx < _xs.size() && _xs[_idx].first < level) { ++_idx; }
+      _current = _idx < _xs.size() && _xs[_idx].first == level
+        ? static_cast<assignment>(_xs[_idx].second)
+        : assignment::None;
+    }
+
+  protected:
+    const assignment&
+    current_assignment()
+    {
+      return _current;
+    }
+  };
+
+  std::vector<__bdd>
+  bdd_restrict(const exec_policy& ep,
+               const std::vector<bdd>& fs,
+               const generator<pair<bdd::label_type, bool>>& xs)
+  {
+    // Materialize the assignment, such that it can be reused for each batch of shared sweeps.
+    std::vector<pair<bdd::label_type, bool>> xs_vec;
+    for (optional<pair<bdd::label_type, bool>> x = xs(); x; x = xs()) {
+      xs_vec.push_back(x.value());
+    }
+
+    std::vector<__bdd> res(fs.begin(), fs.end());
+    if (xs_vec.empty()) { return res; }
+
+    // Restrict all non-terminal BDDs together.
+    std::vector<bdd> fs_internal;
+    std::vector<size_t> fs_idx;
+    for (size_t i = 0u; i < fs.size(); ++i) {
+      if (bdd_isterminal(fs[i])) { continue; }
+
+      fs_internal.push_back(fs[i]);
+      fs_idx.push_back(i);
+    }
+    if (fs_internal.empty()) { return res; }
+
+    bdd_restrict_policy<restrict_vector_mgr> policy(xs_vec);
+    const std::vector<__bdd> res_internal = internal::select_many(ep, fs_internal, policy);
+
+    for (size_t i = 0u; i < fs_idx.size(); ++i) { res[fs_idx[i]] = res_internal[i]; }
+    return res;
+  }
+
+  std::vector<__bdd>
+  bdd_restrict(const std::vector<bdd>& fs, const generator<pair<bdd::label_type, bool>>& xs)
+  {
+    return bdd_restrict(exec_policy(), fs, xs);
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   // Overload: Single-variable Restrict
   __bdd
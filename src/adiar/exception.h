@@ -3,6 +3,7 @@
 
 // Include exceptions from STD for aliasing
 #include <exception>
+#include <new>
 #include <stdexcept>
 #include <system_error>
 
@@ -51,6 +52,11 @@ namespace adiar
   /// \brief System runtime errors with an associated error code.
   ////////////////////////////////////////////////////////////////////////////////////////////////
   using system_error = std::system_error;
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Failure to allocate memory, e.g. beyond a hard memory limit.
+  ////////////////////////////////////////////////////////////////////////////////////////////////
+  using out_of_memory = std::bad_alloc;
 }
 
 #endif // ADIAR_EXCEPTION_H
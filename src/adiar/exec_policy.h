@@ -70,6 +70,10 @@ namespace adiar
     ///          performance on very small instances, or they can be designed for external memory
     ///          such that they can handle decision diagrams much larger than the available memory.
     ///
+    ///          With `Auto`, if it cannot be guaranteed that internal memory suffices, then the
+    ///          data structures start out in internal memory anyway and only spill to external
+    ///          memory, if they actually outgrow it.
+    ///
     /// \note    For more details, please read "Predicting Memory Demands of BDD Operations using
     ///          Maximum Graph Cuts" ATVA 2023.
     ///
@@ -77,7 +81,7 @@ namespace adiar
     ////////////////////////////////////////////////////////////////////////////////////////////////
     enum class memory : char
     {
-      /** Pick \em internal memory as long as it is safe to do so. */
+      /** Pick \em internal memory and only spill to \em external memory when necessary. */
       Auto,
       /** Always use \em internal memory */
       Internal,
@@ -108,7 +112,9 @@ namespace adiar
         /** Use the \em nested \em sweeping framework (recommended). */
         Nested,
         /** Quantify each variable independently. */
-        Singleton
+        Singleton,
+        /** Pick either of the above based on the to-be quantified levels' size and depth. */
+        Auto
       };
     };
 
@@ -155,6 +155,16 @@ namespace adiar
   template <typename VarType>
   using cost = function<double(VarType)>;
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Weight function that assigns a weight to each literal, i.e. to each variable and its
+  ///        value.
+  ///
+  /// \tparam VarType
+  ///    Type of variable labels.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename VarType>
+  using weight = function<double(VarType, bool)>;
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief  Generator function that *produces* a new value of `RetType` for each call.
   ///
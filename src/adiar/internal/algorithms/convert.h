@@ -52,10 +52,11 @@ namespace adiar::internal
       return typename to_policy::dd_type(dd.file_ptr(), dd.is_negated(), 0);
     }
 
+    template <typename Vector>
     static typename to_policy::dd_type
     on_terminal_input(const bool terminal_value,
                       const typename from_policy::dd_type& /*dd*/,
-                      const internal_vector<typename from_policy::label_type>& dom)
+                      const Vector& dom)
     {
       adiar_assert(dom.size() > 0, "Emptiness check is before terminal check");
 
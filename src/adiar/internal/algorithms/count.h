@@ -19,9 +19,10 @@ namespace adiar::internal
   // =================
   //
   // Traverses a Decision Diagram and accumulates a numeric count along each of
-  // its paths.
+  // its paths. The policy may change the count forwarded along each arc, e.g.
+  // to weigh in the node's literal and the levels skipped by the arc.
   //
-  // Examples of uses are `bdd_pathcount` and `bdd_satcount`.
+  // Examples of uses are `bdd_pathcount`, `bdd_satcount`, and `bdd_wmc`.
   //////////////////////////////////////////////////////////////////////////////
 
   //////////////////////////////////////////////////////////////////////////////
@@ -64,7 +65,8 @@ namespace adiar::internal
   class path_count_policy : public DdPolicy
   {
   public:
-    using data_type = path_data;
+    using data_type   = path_data;
+    using result_type = uint64_t;
 
     static constexpr data_type init_data = { 1u };
 
@@ -93,25 +95,39 @@ namespace adiar::internal
     {
       return acc;
     }
+
+    static inline data_type
+    forward(const data_type& d,
+            const typename DdPolicy::node_type& /*n*/,
+            const bool /*arc*/)
+    {
+      return d;
+    }
   };
 
   //////////////////////////////////////////////////////////////////////////////
   template <typename Policy, typename PriorityQueue>
-  inline uint64_t
-  __count_resolve(PriorityQueue& count_pq,
-                  const typename Policy::pointer_type& target,
+  inline typename Policy::result_type
+  __count_resolve(const Policy& policy,
+                  PriorityQueue& count_pq,
+                  const typename Policy::node_type& n,
+                  const bool arc,
                   const typename Policy::data_type& data,
                   const typename Policy::label_type varcount)
   {
-    if (target.is_false()) { return Policy::resolve_false(data, varcount); }
-    if (target.is_true()) { return Policy::resolve_true(data, varcount); }
-    count_pq.push({ { target }, {}, data });
+    const typename Policy::pointer_type target   = n.child(arc);
+    const typename Policy::data_type target_data = policy.forward(data, n, arc);
+
+    if (target.is_false()) { return policy.resolve_false(target_data, varcount); }
+    if (target.is_true()) { return policy.resolve_true(target_data, varcount); }
+    count_pq.push({ { target }, {}, target_data });
     return 0u;
   }
 
   template <typename Policy, typename PriorityQueue>
-  uint64_t
-  __count(const typename Policy::dd_type& dd,
+  typename Policy::result_type
+  __count(const Policy& policy,
+          const typename Policy::dd_type& dd,
           const typename Policy::label_type varcount,
           const size_t pq_max_memory,
           const size_t pq_max_size)
@@ -119,7 +135,7 @@ namespace adiar::internal
     adiar_assert(!dd->is_terminal(), "Count Algorithm does not support terminal case");
 
     // Set up output
-    uint64_t result = 0u;
+    typename Policy::result_type result = 0u;
 
     // Set up input
     node_ifstream<> ns(dd);
@@ -129,7 +145,7 @@ namespace adiar::internal
     {
       const node root = ns.peek();
 
-      count_pq.push({ { root.uid() }, {}, Policy::init_data });
+      count_pq.push({ { root.uid() }, {}, policy.init_data });
     }
 
     // Take out the rest of the nodes and process them one by one
@@ -147,14 +163,14 @@ namespace adiar::internal
         typename Policy::data_type data                  = request.data;
 
         while (count_pq.can_pull() && count_pq.top().target == n.uid()) {
-          data = Policy::merge(std::move(data), count_pq.pull().data);
+          data = policy.merge(std::move(data), count_pq.pull().data);
         }
 
-        data = Policy::merge_end(std::move(data));
+        data = policy.merge_end(std::move(data));
 
         // Forward requests for children of 'n'
-        result += __count_resolve<Policy>(count_pq, n.low(), data, varcount);
-        result += __count_resolve<Policy>(count_pq, n.high(), data, varcount);
+        result += __count_resolve(policy, count_pq, n, false, data, varcount);
+        result += __count_resolve(policy, count_pq, n, true, data, varcount);
       }
     }
 
@@ -162,8 +178,9 @@ namespace adiar::internal
   }
 
   template <typename Policy>
-  uint64_t
+  typename Policy::result_type
   count(const exec_policy& ep,
+        const Policy& policy,
         const typename Policy::dd_type& dd,
         const typename Policy::label_type varcount)
   {
@@ -198,7 +215,7 @@ namespace adiar::internal
 #endif
       return __count<Policy,
                      count_priority_queue_t<typename Policy::data_type, 0, memory_mode::Internal>>(
-        dd, varcount, aux_available_memory, max_pq_size);
+        policy, dd, varcount, aux_available_memory, max_pq_size);
     } else if (!external_only && max_pq_size <= pq_memory_fits) {
 #ifdef ADIAR_STATS
       stats_count.lpq.internal += 1u;
@@ -207,7 +224,16 @@ namespace adiar::internal
                      count_priority_queue_t<typename Policy::data_type,
                                             ADIAR_LPQ_LOOKAHEAD,
                                             memory_mode::Internal>>(
-        dd, varcount, aux_available_memory, max_pq_size);
+        policy, dd, varcount, aux_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_count.lpq.hybrid += 1u;
+#endif
+      return __count<Policy,
+                     count_priority_queue_t<typename Policy::data_type,
+                                            ADIAR_LPQ_LOOKAHEAD,
+                                            memory_mode::Hybrid>>(
+        policy, dd, varcount, aux_available_memory, max_pq_size);
     } else {
 #ifdef ADIAR_STATS
       stats_count.lpq.external += 1u;
@@ -216,9 +242,19 @@ namespace adiar::internal
                      count_priority_queue_t<typename Policy::data_type,
                                             ADIAR_LPQ_LOOKAHEAD,
                                             memory_mode::External>>(
-        dd, varcount, aux_available_memory, max_pq_size);
+        policy, dd, varcount, aux_available_memory, max_pq_size);
     }
   }
+
+  template <typename Policy>
+  typename Policy::result_type
+  count(const exec_policy& ep,
+        const typename Policy::dd_type& dd,
+        const typename Policy::label_type varcount)
+  {
+    Policy policy;
+    return count(ep, policy, dd, varcount);
+  }
 }
 
 #endif // ADIAR_INTERNAL_ALGORITHMS_COUNT_H
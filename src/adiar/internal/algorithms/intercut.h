@@ -145,7 +145,7 @@ namespace adiar::internal
     }
   }
 
-  template <typename Policy, typename PriorityQueue>
+  template <typename Policy, typename PriorityQueue, memory_mode VectorMode>
   typename Policy::__dd_type
   __intercut(const exec_policy& ep,
              const typename Policy::dd_type& dd,
@@ -161,10 +161,10 @@ namespace adiar::internal
     //
     // Alternatively, we could also hack it by wrapping `xs` with a side-effect of updating a
     // variable in this scope. But, the resulting code complexity does not seem worth it.
-    internal_vector<typename Policy::label_type> hit_levels(dd::max_label);
+    vector<VectorMode, typename Policy::label_type> hit_levels(dd::max_label);
     for (auto x = xs(); x; x = xs()) { hit_levels.push_back(x.value()); }
 
-    typename internal_vector<typename Policy::label_type>::iterator ls = hit_levels.begin();
+    auto ls = hit_levels.begin();
     if (ls == hit_levels.end()) { return Policy::on_empty_labels(dd); }
 
     if (n.is_terminal()) { return Policy::on_terminal_input(n.value(), dd, hit_levels); }
@@ -271,24 +271,20 @@ namespace adiar::internal
     return to_size((3 * Policy::mult_factor * max_1level_cut) / 2 + 2);
   }
 
-  template <typename Policy>
+  template <typename Policy, memory_mode VectorMode>
   typename Policy::__dd_type
-  intercut(const exec_policy& ep,
-           const typename Policy::dd_type& dd,
-           const generator<typename Policy::label_type>& xs)
+  __intercut(const exec_policy& ep,
+             const typename Policy::dd_type& dd,
+             const generator<typename Policy::label_type>& xs,
+             const size_t aux_available_memory)
   {
-    // Compute amount of memory available for auxiliary data structures after having opened all
-    // streams.
-    //
-    // We then may derive an upper bound on the size of auxiliary data structures and check whether
-    // we can run them with a faster internal memory variant.
-    const size_t aux_available_memory = memory_available()
-      // Input stream
-      - node_ifstream<>::memory_usage()
-      // Output stream
-      - arc_ofstream::memory_usage();
+    // Only the remaining memory (after the vector of levels has been allocated) is available for
+    // the priority queue.
+    const size_t vector_memory =
+      vector<VectorMode, typename Policy::label_type>::memory_usage(dd::max_label);
 
-    const size_t pq_memory = aux_available_memory;
+    const size_t pq_memory =
+      vector_memory < aux_available_memory ? aux_available_memory - vector_memory : 0u;
 
     const size_t pq_memory_fits =
       intercut_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>::memory_fits(pq_memory);
@@ -306,24 +302,68 @@ namespace adiar::internal
 #ifdef ADIAR_STATS
       stats_intercut.lpq.unbucketed += 1u;
 #endif
-      return __intercut<Policy, intercut_priority_queue_t<0, memory_mode::Internal>>(
+      return __intercut<Policy, intercut_priority_queue_t<0, memory_mode::Internal>, VectorMode>(
         ep, dd, xs, pq_memory, max_pq_size);
     } else if (!external_only && max_pq_size <= pq_memory_fits) {
 #ifdef ADIAR_STATS
       stats_intercut.lpq.internal += 1u;
 #endif
       return __intercut<Policy,
-                        intercut_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
+                        intercut_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>,
+                        VectorMode>(
+        ep, dd, xs, pq_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_intercut.lpq.hybrid += 1u;
+#endif
+      return __intercut<Policy,
+                        intercut_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>,
+                        VectorMode>(
         ep, dd, xs, pq_memory, max_pq_size);
     } else {
 #ifdef ADIAR_STATS
       stats_intercut.lpq.external += 1u;
 #endif
       return __intercut<Policy,
-                        intercut_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>>(
+                        intercut_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>,
+                        VectorMode>(
         ep, dd, xs, pq_memory, max_pq_size);
     }
   }
+
+  template <typename Policy>
+  typename Policy::__dd_type
+  intercut(const exec_policy& ep,
+           const typename Policy::dd_type& dd,
+           const generator<typename Policy::label_type>& xs)
+  {
+    // Compute amount of memory available for auxiliary data structures after having opened all
+    // streams.
+    //
+    // We then may derive an upper bound on the size of auxiliary data structures and check whether
+    // we can run them with a faster internal memory variant.
+    const size_t aux_available_memory = memory_available()
+      // Input stream
+      - node_ifstream<>::memory_usage()
+      // Output stream
+      - arc_ofstream::memory_usage();
+
+    // The levels to cut are kept in internal memory, unless they would take up more than half of
+    // the memory otherwise available to the priority queue.
+    const size_t vector_memory =
+      vector<memory_mode::Internal, typename Policy::label_type>::memory_usage(dd::max_label);
+
+    const bool internal_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
+    const bool external_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::External;
+
+    if (internal_only || (!external_only && vector_memory <= aux_available_memory / 2)) {
+      return __intercut<Policy, memory_mode::Internal>(ep, dd, xs, aux_available_memory);
+    } else {
+      return __intercut<Policy, memory_mode::External>(ep, dd, xs, aux_available_memory);
+    }
+  }
 }
 
 #endif // ADIAR_INTERNAL_ALGORITHMS_INTERCUT_H
@@ -1,6 +1,8 @@
 #ifndef ADIAR_INTERNAL_ALGORITHMS_NESTED_SWEEPING_H
 #define ADIAR_INTERNAL_ALGORITHMS_NESTED_SWEEPING_H
 
+#include <algorithm>
+
 #include <adiar/exec_policy.h>
 #include <adiar/functional.h>
 #include <adiar/statistics.h>
@@ -63,6 +65,9 @@ namespace adiar::internal
       // Pull out all nodes from pq and terminal_arcs for this level
       typename Policy::id_type out_id = Policy::max_id;
 
+      // Number of arcs into this level.
+      size_t level_indegree = 0u;
+
       while (pq.can_pull()
              || (arcs.can_pull_terminal() && arcs.peek_terminal().source().label() == in_label)) {
         // TODO (MDD / QMDD):
@@ -94,18 +99,23 @@ namespace adiar::internal
           // The out_idx is included in arc.source() pulled from the internal arcs.
           const node::pointer_type s = arcs.pull_internal().source();
           pq.push(arc(s, t));
+
+          level_indegree += 1u;
         }
       }
 
       // Update with new possible maximum 1-level cut.
       out.unsafe_max_1level_cut(local_1level_cut);
 
-      // Add number of nodes to level information, if any nodes were pushed to the output.
-      // Furthermore, mark as unsorted if at least two nodes were output (their order might
-      // very much have been wrong).
+      // Add number of nodes (and the 2-level cut with the level below) to level information, if
+      // any nodes were pushed to the output. Furthermore, mark as unsorted if at least two nodes
+      // were output (their order might very much have been wrong).
       if (out_id != Policy::max_id) {
         const size_t width = Policy::max_id - out_id;
-        out.unsafe_push(level_info(out_label, width));
+        const size_t level_2level_cut =
+          local_1level_cut[cut::Internal] + level_indegree + out.unsafe_outdegree_below();
+
+        out.unsafe_push(level_info(out_label, width, level_2level_cut));
 
         if (width > 1u) { out.unsafe_set_sorted(false); }
       }
@@ -204,6 +214,13 @@ namespace adiar::internal
           return sorter_t::memory_fits(memory_bytes);
         }
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        static constexpr size_t
+        memory_minimum()
+        {
+          return sorter_t::memory_minimum();
+        }
+
       public:
         ////////////////////////////////////////////////////////////////////////////////////////////
         roots_sorter(size_t memory_bytes, size_t no_arcs)
@@ -1012,6 +1029,9 @@ namespace adiar::internal
         const size_t inner_pq_max_size =
           internal_only ? std::min(inner_pq_fits, inner_pq_bound) : inner_pq_bound;
 
+        const size_t inner_pq_memory_minimum =
+          Policy::template pq_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>::memory_minimum();
+
         // TODO (bdd_compose): ask 'Policy' implementation for the initalizer list
         if (!external_only
             && inner_pq_max_size <= no_lookahead_bound(OuterRoots::value_type::cardinality)) {
@@ -1047,6 +1067,41 @@ namespace adiar::internal
           using decorator_t = down__pq_decorator<InnerPriorityQueue, OuterRoots>;
           decorator_t decorated_pq(inner_pq, outer_roots);
 
+          return use_random_access
+            ? policy_impl.sweep_ra(ep, outer_file, decorated_pq, inner_remaining_memory)
+            : policy_impl.sweep_pq(ep, outer_file, decorated_pq, inner_remaining_memory);
+        } else if (inner_pq_memory < inner_pq_memory_minimum) {
+          // Too little memory for the buckets' sorters: fall back to a single priority queue.
+#ifdef ADIAR_STATS
+          lpq_stats.external += 1u;
+          lpq_stats.low_memory += 1u;
+#endif
+          using InnerPriorityQueue = typename Policy::template pq_t<0, memory_mode::External>;
+          InnerPriorityQueue inner_pq({ typename Policy::dd_type(outer_file) },
+                                      inner_pq_memory,
+                                      inner_pq_max_size,
+                                      lpq_stats);
+
+          using decorator_t = down__pq_decorator<InnerPriorityQueue, OuterRoots>;
+          decorator_t decorated_pq(inner_pq, outer_roots);
+
+          return use_random_access
+            ? policy_impl.sweep_ra(ep, outer_file, decorated_pq, inner_remaining_memory)
+            : policy_impl.sweep_pq(ep, outer_file, decorated_pq, inner_remaining_memory);
+        } else if (!external_only) {
+#ifdef ADIAR_STATS
+          lpq_stats.hybrid += 1u;
+#endif
+          using InnerPriorityQueue =
+            typename Policy::template pq_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>;
+          InnerPriorityQueue inner_pq({ typename Policy::dd_type(outer_file) },
+                                      inner_pq_memory,
+                                      inner_pq_max_size,
+                                      lpq_stats);
+
+          using decorator_t = down__pq_decorator<InnerPriorityQueue, OuterRoots>;
+          decorator_t decorated_pq(inner_pq, outer_roots);
+
           return use_random_access
             ? policy_impl.sweep_ra(ep, outer_file, decorated_pq, inner_remaining_memory)
             : policy_impl.sweep_pq(ep, outer_file, decorated_pq, inner_remaining_memory);
@@ -1562,6 +1617,9 @@ namespace adiar::internal
           ? std::min(inner_pq_memory_fits, inner_pq_bound)
           : inner_pq_bound;
 
+        const size_t inner_pq_memory_minimum =
+          up__pq_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>::memory_minimum();
+
         const bool external_only =
           ep.template get<exec_policy::memory>() == exec_policy::memory::External;
 
@@ -1594,6 +1652,36 @@ namespace adiar::internal
                                                 inner_pq_max_size,
                                                 inner_sorters_memory,
                                                 is_last_inner);
+        } else if (inner_pq_memory < inner_pq_memory_minimum) {
+          // Too little memory for the buckets' sorters: fall back to a single priority queue.
+#ifdef ADIAR_STATS
+          stats.inner_up.lpq.external += 1u;
+          stats.inner_up.lpq.low_memory += 1u;
+#endif
+          using InnerPriorityQueue = up__pq_t<0, memory_mode::External>;
+          return up<Policy, InnerPriorityQueue>(ep,
+                                                outer_arcs,
+                                                outer_pq,
+                                                outer_ofstream,
+                                                inner_arcs_file,
+                                                inner_pq_memory,
+                                                inner_pq_max_size,
+                                                inner_sorters_memory,
+                                                is_last_inner);
+        } else if (!external_only) {
+#ifdef ADIAR_STATS
+          stats.inner_up.lpq.hybrid += 1u;
+#endif
+          using InnerPriorityQueue = up__pq_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>;
+          return up<Policy, InnerPriorityQueue>(ep,
+                                                outer_arcs,
+                                                outer_pq,
+                                                outer_ofstream,
+                                                inner_arcs_file,
+                                                inner_pq_memory,
+                                                inner_pq_max_size,
+                                                inner_sorters_memory,
+                                                is_last_inner);
         } else {
 #ifdef ADIAR_STATS
           stats.inner_up.lpq.external += 1u;
@@ -1611,6 +1699,36 @@ namespace adiar::internal
         }
       }
     } // namespace inner
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Minimum amount of memory needed for Nested Sweeping.
+    ///
+    /// \details The memory is split evenly between the outer and the inner sweeps. With less
+    ///          memory than for their bucketed priority queues, both fall back to a single
+    ///          external priority queue. Hence, this is the memory needed for the outer sweep's
+    ///          streams, priority queue, and roots sorter or for the inner sweep's streams and
+    ///          (up to) two priority queues, whichever is the larger.
+    ///
+    /// \see     nested_sweep
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename Policy>
+    size_t
+    memory_minimum()
+    {
+      using request_t      = typename Policy::request_t;
+      using request_pred_t = typename Policy::request_pred_t;
+
+      const size_t outer_memory = arc_ifstream<>::memory_usage()
+        + level_info_ifstream<>::memory_usage() + outer::inner_iterator<Policy>::memory_usage()
+        + node_ofstream::memory_usage()
+        + outer::up__pq_t<0, memory_mode::External>::memory_minimum()
+        + outer::roots_sorter<memory_mode::External, request_t, request_pred_t>::memory_minimum();
+
+      const size_t inner_memory = Policy::stream_memory()
+        + 2u * Policy::template pq_t<0, memory_mode::External>::memory_minimum();
+
+      return 2u * std::max(outer_memory, inner_memory);
+    }
   } // namespace nested_sweeping
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1677,13 +1795,14 @@ namespace adiar::internal
     // Outer Up Sweep: Use the 'inner_memory' for the per-level data structures
     // and streams. This is safe, since these data structures are only
     // instantiated when the Inner Sweep is not.
+    adiar_assert(iofstream<mapping>::memory_usage() < inner_memory,
+                 "Enough memory should be left for the per-level data structures");
+
     const size_t outer_sorters_memory = inner_memory - iofstream<mapping>::memory_usage();
 
     const size_t outer_internal_sorter_can_fit =
       internal_sorter<node>::memory_fits(outer_sorters_memory / 2);
 
-    // TODO: assert enough memory is still available for the remaining things
-
     // Inner Down Sweep:
     //
     // 1. We need to create requests for roots of the Inner Down Sweep in (i) the Outer Down Sweep
@@ -2075,6 +2194,10 @@ namespace adiar::internal
   ///
   /// \param policy_impl     Provides the non-static parts of the inner logic that determines when
   ///                        to start the nested sweep.
+  ///
+  /// \throws out_of_memory  If less than `nested_sweeping::memory_minimum<Policy>()` memory is
+  ///                        available. Callers that can degrade further (e.g. to repeated single
+  ///                        sweeps) should check this beforehand.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   template <typename Policy>
   typename Policy::dd_type
@@ -2108,6 +2231,7 @@ namespace adiar::internal
     // Here, we still need to keep in mind, that the available memory needs to be distributed across
     // (up to) four priority queues!
     const size_t total_memory = memory_available();
+    if (total_memory < nested_sweeping::memory_minimum<Policy>()) { throw out_of_memory(); }
 
     const size_t outer_memory = total_memory / 2;
     const size_t inner_memory = total_memory - outer_memory;
@@ -2141,13 +2265,22 @@ namespace adiar::internal
 
     const size_t outer_roots_memory_fits = internal_roots_sorter_t::memory_fits(outer_pq_memory);
 
-    const size_t pq_roots_bound = (dag->max_1level_cut * 3u) / 2u;
+    // If the DAG was obtained from a reduced input, then its 2-level cut may be much tighter than
+    // the estimate based on the 1-level cut.
+    const size_t pq_roots_bound = input.template has<shared_node_file_type>()
+      ? std::min((dag->max_1level_cut * 3u) / 2u, input.max_2level_cut(cut::Internal))
+      : (dag->max_1level_cut * 3u) / 2u;
 
     const size_t outer_pq_roots_max =
       ep.template get<exec_policy::memory>() == exec_policy::memory::Internal
       ? std::min({ outer_pq_memory_fits, outer_roots_memory_fits, pq_roots_bound })
       : pq_roots_bound;
 
+    using outer_external_lpq_t =
+      nested_sweeping::outer::up__pq_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>;
+
+    const size_t outer_pq_memory_minimum = outer_external_lpq_t::memory_minimum();
+
     const bool external_only =
       ep.template get<exec_policy::memory>() == exec_policy::memory::External;
     if (!external_only && outer_pq_roots_max <= no_lookahead_bound(1)) {
@@ -2173,6 +2306,30 @@ namespace adiar::internal
                                                                                 outer_roots_memory,
                                                                                 outer_pq_roots_max,
                                                                                 inner_memory);
+    } else if (outer_pq_memory < outer_pq_memory_minimum) {
+      // Too little memory for the buckets' sorters: fall back to a single priority queue.
+#ifdef ADIAR_STATS
+      nested_sweeping::stats.outer_up.lpq.external += 1u;
+      nested_sweeping::stats.outer_up.lpq.low_memory += 1u;
+#endif
+      return __nested_sweep<Policy, 0, memory_mode::External>(ep,
+                                                              dag,
+                                                              policy_impl,
+                                                              outer_pq_memory,
+                                                              outer_roots_memory,
+                                                              outer_pq_roots_max,
+                                                              inner_memory);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      nested_sweeping::stats.outer_up.lpq.hybrid += 1u;
+#endif
+      return __nested_sweep<Policy, ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>(ep,
+                                                                              dag,
+                                                                              policy_impl,
+                                                                              outer_pq_memory,
+                                                                              outer_roots_memory,
+                                                                              outer_pq_roots_max,
+                                                                              inner_memory);
     } else {
 #ifdef ADIAR_STATS
       nested_sweeping::stats.outer_up.lpq.external += 1u;
@@ -7,13 +7,17 @@
 #include "adiar/internal/io/arc_ifstream.h"
 #include "adiar/types.h"
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <memory>
 #include <stdint.h>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include <adiar/exec_policy.h>
 
@@ -24,7 +28,11 @@
 #include <adiar/internal/dd_func.h>
 #include <adiar/internal/io/arc_file.h>
 #include <adiar/internal/io/arc_ofstream.h>
+#include <adiar/internal/io/file.h>
+#include <adiar/internal/io/ifstream.h>
 #include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/io/ofstream.h>
+#include <adiar/internal/memory.h>
 
 namespace adiar::internal
 {
@@ -232,6 +240,12 @@ namespace adiar::internal
 #endif
       return __optmin<Policy, optmin_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
         policy, dd, aux_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_optmin.lpq.hybrid += 1u;
+#endif
+      return __optmin<Policy, optmin_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>>(
+        policy, dd, aux_available_memory, max_pq_size);
     } else {
 #ifdef ADIAR_STATS
       stats_optmin.lpq.external += 1u;
@@ -240,6 +254,353 @@ namespace adiar::internal
         policy, dd, aux_available_memory, max_pq_size);
     }
   }
+
+  //////////////////////////////////////////////////////////////////////////////
+  //  K-Best OptMin Algorithm
+  // =========================
+  //
+  // Same top-down traversal as above, but each node keeps (in a bounded heap)
+  // the `k` cheapest requests rather than only the cheapest one. Costs are
+  // vectors that are compared lexicographically, i.e. the first objective is
+  // primary and each later objective only breaks ties of the prior ones.
+  //
+  // Each kept request for a node is given its rank among the requests for that
+  // node. Together with its parent's rank, this is written to a file which is
+  // read in reverse to reconstruct all paths to the true terminal in a single
+  // bottom-up pass.
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Lexicographic (multi-objective) cost of a path.
+  template <size_t Objectives>
+  using optmin_cost = std::array<double, Objectives>;
+
+  template <size_t Objectives>
+  inline optmin_cost<Objectives>
+  optmin_cost_add(const optmin_cost<Objectives>& a, const optmin_cost<Objectives>& b)
+  {
+    optmin_cost<Objectives> res;
+    for (size_t i = 0; i < Objectives; ++i) { res[i] = a[i] + b[i]; }
+    return res;
+  }
+
+  template <size_t Objectives>
+  inline optmin_cost<Objectives>
+  optmin_cost_inf()
+  {
+    optmin_cost<Objectives> res;
+    res.fill(std::numeric_limits<double>::infinity());
+    return res;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Data structures
+  template <size_t Objectives>
+  struct optmin_k_data
+  {
+    static constexpr bool sort_on_tiebreak = false;
+    static constexpr bool has_level        = false;
+
+    /// Cost of path
+    optmin_cost<Objectives> cost;
+
+    /// Parent pointer (with the taken arc as its out-index)
+    node::pointer_type source;
+
+    /// Rank of the path among all kept paths to `source`
+    size_t source_rank;
+  };
+
+  template <size_t Objectives>
+  using optmin_k_request = request_data<1, optmin_k_data<Objectives>>;
+
+  template <size_t Objectives, size_t look_ahead, memory_mode mem_mode>
+  using optmin_k_priority_queue_t =
+    levelized_node_priority_queue<optmin_k_request<Objectives>,
+                                  request_data_first_lt<optmin_k_request<Objectives>>,
+                                  look_ahead,
+                                  mem_mode,
+                                  1u,
+                                  0u>;
+
+  /// \brief The `rank`th path to `target` came from the `source_rank`th path to `source`.
+  struct optmin_k_parent
+  {
+    node::uid_type target;
+    size_t rank;
+    node::pointer_type source;
+    size_t source_rank;
+  };
+
+  /// \brief A path to the true terminal that ends with the arc `end` of the `rank`th path to
+  ///        its source.
+  template <size_t Objectives>
+  struct optmin_k_solution
+  {
+    optmin_cost<Objectives> cost;
+    node::pointer_type end;
+    size_t rank;
+  };
+
+  template <typename Policy, typename PriorityQueue>
+  std::vector<optmin_cost<Policy::objectives>>
+  __optmin_k(Policy& policy,
+             const typename Policy::dd_type& dd,
+             const size_t k,
+             const size_t pq_max_memory,
+             const size_t pq_max_size)
+  {
+    adiar_assert(!dd->is_terminal(), "OptMin Algorithm does not support terminal case");
+    adiar_assert(0 < k, "Requires at least one solution to be requested");
+
+    constexpr size_t objectives = Policy::objectives;
+    using cost_type             = optmin_cost<objectives>;
+    using request_type          = optmin_k_request<objectives>;
+    using solution_type         = optmin_k_solution<objectives>;
+
+    const auto request_lt = [](const request_type& a, const request_type& b) {
+      return a.data.cost < b.data.cost;
+    };
+    const auto solution_lt = [](const solution_type& a, const solution_type& b) {
+      return a.cost < b.cost;
+    };
+
+    // Set up temporary outputs
+    shared_file<optmin_k_parent> parent_graph;
+
+    // Max-heap of the (up to) k best solutions found so far
+    memory_vector<solution_type> solutions;
+    solutions.reserve(k);
+
+    // Cost a path must be strictly better than to be part of the result
+    const auto threshold = [&]() -> cost_type {
+      return solutions.size() < k ? optmin_cost_inf<objectives>() : solutions.front().cost;
+    };
+
+    const auto offer_solution = [&](const cost_type& c, const node::pointer_type& end, size_t r) {
+      if (!(c < threshold())) { return; }
+      if (solutions.size() == k) {
+        std::pop_heap(solutions.begin(), solutions.end(), solution_lt);
+        solutions.pop_back();
+      }
+      solutions.push_back({ c, end, r });
+      std::push_heap(solutions.begin(), solutions.end(), solution_lt);
+    };
+
+    {
+      ofstream<optmin_k_parent> pw(parent_graph);
+
+      // Set up input
+      node_ifstream<> ns(dd);
+
+      // Set up cross-level priority queue with a request for the root
+      PriorityQueue optmin_pq({ dd }, pq_max_memory, pq_max_size, stats_optmin.lpq);
+      {
+        const node root = ns.peek();
+
+        const cost_type zero = {};
+        optmin_pq.push({ { root.uid() }, {}, { zero, node::pointer_type::nil(), 0u } });
+      }
+
+      // Bounded max-heap of the k cheapest requests for the current node
+      memory_vector<request_type> best;
+      best.reserve(k);
+
+      while (!optmin_pq.empty()) {
+        optmin_pq.setup_next_level();
+
+        const typename Policy::label_type label = optmin_pq.current_level();
+        const cost_type c                       = policy.cost_fn(label);
+
+        while (!optmin_pq.empty_level()) {
+          const node::uid_type t = optmin_pq.top().target[0];
+
+          best.clear();
+          while (optmin_pq.can_pull() && optmin_pq.top().target[0] == t) {
+            const request_type r = optmin_pq.pull();
+
+            if constexpr (Policy::bullying) {
+              if (!(r.data.cost < threshold())) { continue; }
+            }
+
+            if (best.size() < k) {
+              best.push_back(r);
+              std::push_heap(best.begin(), best.end(), request_lt);
+            } else if (r.data.cost < best.front().data.cost) {
+              std::pop_heap(best.begin(), best.end(), request_lt);
+              best.back() = r;
+              std::push_heap(best.begin(), best.end(), request_lt);
+            }
+          }
+
+          if (best.empty()) { continue; }
+          std::sort_heap(best.begin(), best.end(), request_lt);
+
+          const node n = ns.seek(t);
+          adiar_assert(n.uid() == t);
+
+          for (size_t rank = 0; rank < best.size(); ++rank) {
+            const request_type& r = best[rank];
+
+            if (!r.data.source.is_nil()) {
+              pw << optmin_k_parent{ t, rank, r.data.source, r.data.source_rank };
+            }
+
+            // The accumulated costs to be passed on if this variable is unset or set respectively
+            const cost_type cost_low  = r.data.cost;
+            const cost_type cost_high = optmin_cost_add(r.data.cost, c);
+
+            if constexpr (Policy::bullying) {
+              if (!(cost_low < threshold())) { break; }
+            }
+
+            if (n.low().is_terminal()) {
+              if (n.low().is_true()) { offer_solution(cost_low, n.uid().as_ptr(false), rank); }
+            } else {
+              optmin_pq.push({ { n.low() }, {}, { cost_low, n.uid().as_ptr(false), rank } });
+            }
+
+            if constexpr (Policy::bullying) {
+              if (!(cost_high < threshold())) { continue; }
+            }
+
+            if (n.high().is_terminal()) {
+              if (n.high().is_true()) { offer_solution(cost_high, n.uid().as_ptr(true), rank); }
+            } else {
+              optmin_pq.push({ { n.high() }, {}, { cost_high, n.uid().as_ptr(true), rank } });
+            }
+          }
+        }
+      }
+    }
+
+    // Unreachable - this is handled in our caller "optmin_k"
+    adiar_assert(!solutions.empty());
+
+    std::sort_heap(solutions.begin(), solutions.end(), solution_lt);
+
+    // Run through the parent graph in reverse, following all paths at once. The nodes that are
+    // still to be visited are identified by their uid and the rank of the path that led to them.
+    memory_map<std::pair<node::pointer_type, size_t>, memory_vector<size_t>> wanted;
+
+    for (size_t i = 0; i < solutions.size(); ++i) {
+      const node::pointer_type end = solutions[i].end;
+      policy.out(i, end.label(), end.out_idx());
+      wanted[{ essential(end), solutions[i].rank }].push_back(i);
+    }
+
+    {
+      ifstream<optmin_k_parent, true> pr(parent_graph);
+      while (pr.can_pull()) {
+        const optmin_k_parent p = pr.pull();
+
+        const auto it = wanted.find({ p.target, p.rank });
+        if (it == wanted.end()) { continue; }
+
+        const memory_vector<size_t> indices = std::move(it->second);
+        wanted.erase(it);
+
+        memory_vector<size_t>& next = wanted[{ essential(p.source), p.source_rank }];
+        for (const size_t i : indices) {
+          policy.out(i, p.source.label(), p.source.out_idx());
+          next.push_back(i);
+        }
+      }
+    }
+
+    std::vector<cost_type> res;
+    res.reserve(solutions.size());
+    for (const solution_type& s : solutions) { res.push_back(s.cost); }
+    return res;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The (up to) `k` cheapest paths to the true terminal.
+  ///
+  /// \details The policy provides the number of `objectives`, a `cost_fn` that returns an
+  ///          `optmin_cost<objectives>` for each level, and an `out(i, label, value)` function
+  ///          that is called (per path) in descending order.
+  ///
+  /// \returns The cost of each found path (in ascending lexicographic order).
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  std::vector<optmin_cost<Policy::objectives>>
+  optmin_k(const exec_policy& ep, Policy& policy, const typename Policy::dd_type& dd, size_t k)
+  {
+    if (k == 0 || dd_isfalse(dd)) { return {}; }
+    if (dd_istrue(dd)) { return { optmin_cost<Policy::objectives>{} }; }
+
+    constexpr size_t objectives = Policy::objectives;
+
+    // Compute amount of memory available for auxiliary data structures after having opened all
+    // streams.
+    //
+    // We then may derive an upper bound on the size of auxiliary data structures and check whether
+    // we can run them with a faster internal memory variant.
+    //
+    // The (up to) k solutions and the (up to) k requests for the current node are kept in memory
+    // next to the priority queue and hence are excluded from its budget. The `wanted` map of the
+    // reverse pass is only built after the priority queue has been destructed.
+    constexpr size_t k_entry_size =
+      sizeof(optmin_k_solution<objectives>) + sizeof(optmin_k_request<objectives>);
+
+    const size_t k_memory = k <= std::numeric_limits<size_t>::max() / k_entry_size
+      ? k * k_entry_size
+      : std::numeric_limits<size_t>::max();
+
+    const size_t streams_available_memory = memory_available() - node_ifstream<>::memory_usage()
+      - ofstream<optmin_k_parent>::memory_usage();
+
+    const size_t aux_available_memory =
+      k_memory < streams_available_memory ? streams_available_memory - k_memory : 0u;
+
+    using internal_pq_type =
+      optmin_k_priority_queue_t<objectives, ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>;
+
+    const size_t pq_memory_fits = internal_pq_type::memory_fits(aux_available_memory);
+
+    const bool internal_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
+    const bool external_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::External;
+
+    // Every arc carries up to k requests.
+    const size_t cut_bound = dd.max_2level_cut(cut::Internal);
+    const size_t pq_bound  = cut_bound <= std::numeric_limits<size_t>::max() / k
+      ? cut_bound * k
+      : std::numeric_limits<size_t>::max();
+
+    const size_t max_pq_size = internal_only ? std::min(pq_memory_fits, pq_bound) : pq_bound;
+
+    if (!external_only && max_pq_size <= no_lookahead_bound()) {
+#ifdef ADIAR_STATS
+      stats_optmin.lpq.unbucketed += 1u;
+#endif
+      return __optmin_k<Policy, optmin_k_priority_queue_t<objectives, 0, memory_mode::Internal>>(
+        policy, dd, k, aux_available_memory, max_pq_size);
+    } else if (!external_only && max_pq_size <= pq_memory_fits) {
+#ifdef ADIAR_STATS
+      stats_optmin.lpq.internal += 1u;
+#endif
+      return __optmin_k<Policy, internal_pq_type>(policy, dd, k, aux_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_optmin.lpq.hybrid += 1u;
+#endif
+      return __optmin_k<
+        Policy,
+        optmin_k_priority_queue_t<objectives, ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>>(
+        policy, dd, k, aux_available_memory, max_pq_size);
+    } else {
+#ifdef ADIAR_STATS
+      stats_optmin.lpq.external += 1u;
+#endif
+      return __optmin_k<
+        Policy,
+        optmin_k_priority_queue_t<objectives, ADIAR_LPQ_LOOKAHEAD, memory_mode::External>>(
+        policy, dd, k, aux_available_memory, max_pq_size);
+    }
+  }
 }
 
 #endif // ADIAR_INTERNAL_ALGORITHMS_OPTMIN_H
@@ -249,6 +249,19 @@ namespace adiar::internal
 
       return __comparison_check<Policy, priority_queue_1_type, priority_queue_2_type>(
         in_0, in_1, pq_1_internal_memory, pq_2_internal_memory, max_pq_1_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_equality.lpq.hybrid += 1u;
+#endif
+      using priority_queue_1_type =
+        comparison_priority_queue_1_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>;
+      using priority_queue_2_type = comparison_priority_queue_2_t<memory_mode::Hybrid>;
+
+      const size_t pq_1_memory = aux_available_memory / 2;
+      const size_t pq_2_memory = pq_1_memory;
+
+      return __comparison_check<Policy, priority_queue_1_type, priority_queue_2_type>(
+        in_0, in_1, pq_1_memory, pq_2_memory, max_pq_1_size);
     } else {
 #ifdef ADIAR_STATS
       stats_equality.lpq.external += 1u;
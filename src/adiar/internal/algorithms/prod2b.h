@@ -1,7 +1,9 @@
 #ifndef ADIAR_INTERNAL_ALGORITHMS_PROD2B_H
 #define ADIAR_INTERNAL_ALGORITHMS_PROD2B_H
 
+#include <algorithm>
 #include <variant>
+#include <vector>
 
 #include <adiar/exec_policy.h>
 
@@ -11,6 +13,7 @@
 #include <adiar/internal/bool_op.h>
 #include <adiar/internal/cnl.h>
 #include <adiar/internal/cut.h>
+#include <adiar/internal/cut_profile.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
 #include <adiar/internal/data_types/node.h>
 #include <adiar/internal/data_types/request.h>
@@ -336,7 +339,7 @@ namespace adiar::internal
           : Policy::reduction_rule_inv(req.target[pq_idx]);
 
         const typename Policy::children_type children_ra = req.target[ra_idx].level() == out_label
-          ? in_nodes_ra.at(req.target[ra_idx]).children()
+          ? in_nodes_ra.children(req.target[ra_idx])
           : Policy::reduction_rule_inv(req.target[ra_idx]);
 
         // Create pairing of product children
@@ -604,6 +607,60 @@ namespace adiar::internal
                    + right_terminal_vals * left_2level_cut + 2u);
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// Derives an upper bound on the output's maximum 2-level cut similar to the one above. But,
+  /// rather than pairing the maxima of both inputs, only the cuts on the same level are paired.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  size_t
+  __prod2b_profile_upper_bound(const typename Policy::dd_type& in_0,
+                               const typename Policy::dd_type& in_1,
+                               const Policy& policy)
+  {
+    // Left-hand side
+    cut_profile left_profile(in_0);
+
+    const cut left_ct                    = policy.left_cut();
+    const safe_size_t left_terminal_vals = left_ct.number_of_terminals();
+
+    const safe_size_t left_terminal_arcs =
+      in_0.max_1level_cut(left_ct) - in_0.max_1level_cut(cut::Internal);
+
+    // Right-hand side
+    cut_profile right_profile(in_1);
+
+    const cut right_ct                    = policy.right_cut();
+    const safe_size_t right_terminal_vals = right_ct.number_of_terminals();
+
+    const safe_size_t right_terminal_arcs =
+      in_1.max_1level_cut(right_ct) - in_1.max_1level_cut(cut::Internal);
+
+    // Compute the cut for each level (in both inputs) and keep the largest one.
+    size_t result = 0u;
+
+    while (left_profile.has_next() || right_profile.has_next()) {
+      const typename Policy::label_type level =
+        std::min(left_profile.has_next() ? left_profile.next_level() : Policy::max_label,
+                 right_profile.has_next() ? right_profile.next_level() : Policy::max_label);
+
+      left_profile.seek(level);
+      const safe_size_t left_2level_cut = left_profile.max_2level_cut();
+      const safe_size_t left_1level_cut = left_profile.max_1level_cut();
+
+      right_profile.seek(level);
+      const safe_size_t right_2level_cut = right_profile.max_2level_cut();
+      const safe_size_t right_1level_cut = right_profile.max_1level_cut();
+
+      const size_t level_cut =
+        to_size(left_2level_cut * right_2level_cut + (right_1level_cut * left_terminal_arcs)
+                + left_terminal_vals * right_2level_cut + (left_1level_cut * right_terminal_arcs)
+                + right_terminal_vals * left_2level_cut + 2u);
+
+      result = std::max(result, level_cut);
+    }
+    return result;
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Upper bound on i-level cut based on the maximum possible number of nodes in the output.
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -642,6 +699,7 @@ namespace adiar::internal
     const size_t pq_bound =
       std::min({ __prod2b_ilevel_upper_bound<get_2level_cut, 2u>(in_0, in_1, policy),
                  __prod2b_2level_upper_bound(in_0, in_1, policy),
+                 __prod2b_profile_upper_bound(in_0, in_1, policy),
                  __prod2b_ilevel_upper_bound(in_0, in_1, policy) });
 
     // Possibly flip inputs (and operator) such that 'in_ra' is always the second argument to
@@ -690,6 +748,12 @@ namespace adiar::internal
 #endif
       return __prod2b_ra<Policy, prod_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
         ep, in_pq, in_ra, policy, pq_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_prod2b.lpq.hybrid += 1u;
+#endif
+      return __prod2b_ra<Policy, prod_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>>(
+        ep, in_pq, in_ra, policy, pq_available_memory, max_pq_size);
     } else {
 #ifdef ADIAR_STATS
       stats_prod2b.lpq.external += 1u;
@@ -714,6 +778,7 @@ namespace adiar::internal
     const size_t pq_1_bound =
       std::min({ __prod2b_ilevel_upper_bound<get_2level_cut, 2u>(in_0, in_1, policy),
                  __prod2b_2level_upper_bound(in_0, in_1, policy),
+                 __prod2b_profile_upper_bound(in_0, in_1, policy),
                  __prod2b_ilevel_upper_bound(in_0, in_1, policy) });
 
     // Compute amount of memory available for auxiliary data structures after having opened all
@@ -785,6 +850,18 @@ namespace adiar::internal
                                                        max_pq_1_size,
                                                        pq_2_internal_memory,
                                                        max_pq_2_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_prod2b.lpq.hybrid += 1u;
+#endif
+      using pq_1_type = prod_priority_queue_1_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>;
+      const size_t pq_1_memory = aux_available_memory / 2;
+
+      using pq_2_type          = prod_priority_queue_2_t<memory_mode::Hybrid>;
+      const size_t pq_2_memory = pq_1_memory;
+
+      return __prod2b_pq<Policy, pq_1_type, pq_2_type>(
+        ep, in_0, in_1, policy, pq_1_memory, max_pq_1_size, pq_2_memory, max_pq_2_size);
     } else {
 #ifdef ADIAR_STATS
       stats_prod2b.lpq.external += 1u;
@@ -876,6 +953,360 @@ namespace adiar::internal
 #endif
     return __prod2b_pq<Policy>(ep, in_0, in_1, policy);
   }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  //  Multi-root 2-ary Product Construction
+  // =======================================
+  //
+  // Given many Decision Diagrams on the left and one common Decision Diagram on the right,
+  // construct the product of each of the former with the latter within a single top-down sweep.
+  // Each request is tagged with the index of the output it belongs to. The common right-hand side
+  // is accessed with Random Access, i.e. each of its levels is only read once for all outputs,
+  // while each left-hand side is read from (and each output is written to) its own files.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Data structures
+  using prod2b_many_request = request_data<2, with_output_and_parent>;
+
+  template <size_t look_ahead, memory_mode mem_mode>
+  using prod_many_priority_queue_t =
+    levelized_node_priority_queue<prod2b_many_request,
+                                  request_data_lt<prod2b_many_request>,
+                                  look_ahead,
+                                  mem_mode,
+                                  1,
+                                  0>;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Forward edge from `source` to `target` within the given `output`.
+  ///
+  /// \see __prod2b_recurse_out
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename PriorityQueue>
+  inline void
+  __prod2b_many_recurse_out(PriorityQueue& pq,
+                            arc_ofstream& aw,
+                            const Policy& policy,
+                            const size_t output,
+                            const ptr_uint64& source,
+                            const typename PriorityQueue::value_type::target_t& target)
+  {
+    if (target[0].is_terminal() && target[1].is_terminal()) {
+      const arc out_arc = { source, policy(target[0], target[1]) };
+      aw.push_terminal(out_arc);
+    } else {
+      adiar_assert(source.label() < std::min(target[0], target[1]).label(),
+                   "should always push recursion for 'later' level");
+
+      pq.push({ target, {}, { output, source } });
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Multi-root 2-ary Product Construction Algorithm where Random Access is used to get
+  ///        nodes from the common right-hand side.
+  ///
+  /// \pre `in_ra` is indexable and none of the inputs are terminals.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename PriorityQueue>
+  std::vector<typename Policy::__dd_type>
+  __prod2b_ra_many(const exec_policy& ep,
+                   const std::vector<typename Policy::dd_type>& ins_pq,
+                   const typename Policy::dd_type& in_ra,
+                   Policy& policy,
+                   const size_t pq_memory,
+                   const size_t max_pq_size)
+  {
+    constexpr size_t pq_idx = 0;
+    constexpr size_t ra_idx = 1;
+
+    const size_t outputs = ins_pq.size();
+
+    // Set up outputs
+    std::vector<typename Policy::__dd_type> res(outputs);
+
+    memory_vector<shared_levelized_file<arc>> out_arcs(outputs);
+    memory_vector<arc_ofstream> aws(outputs);
+
+    memory_vector<typename Policy::id_type> out_ids(outputs, 0u);
+    memory_vector<bool> output_terminal(outputs, false);
+
+    for (size_t i = 0u; i < outputs; ++i) { aws[i].open(out_arcs[i]); }
+
+    // Set up inputs
+    memory_vector<unique_ptr<node_ifstream<>>> ins_nodes_pq;
+    ins_nodes_pq.reserve(outputs);
+
+    memory_vector<node> vs_pq;
+    vs_pq.reserve(outputs);
+
+    for (const typename Policy::dd_type& in_pq : ins_pq) {
+      ins_nodes_pq.push_back(adiar::make_unique<node_ifstream<>>(in_pq));
+      vs_pq.push_back(ins_nodes_pq.back()->pull());
+    }
+
+    node_raccess in_nodes_ra(in_ra);
+
+    // Set up cross-level priority queue with the levels of all inputs
+    memory_vector<typename Policy::dd_type> ins(ins_pq.begin(), ins_pq.end());
+    ins.push_back(in_ra);
+
+    const memory_vector<typename Policy::label_type> levels = union_of_levels(ins);
+
+    PriorityQueue prod_pq(
+      { make_generator(levels.begin(), levels.end()) }, pq_memory, max_pq_size, stats_prod2b.lpq);
+
+    for (size_t i = 0u; i < outputs; ++i) {
+      prod_pq.push({ { vs_pq[i].uid(), in_nodes_ra.root() }, {}, { i, ptr_uint64::nil() } });
+    }
+
+    for (size_t i = 0u; i < outputs; ++i) { out_arcs[i]->max_1level_cut = prod_pq.size(); }
+
+    // Process all requests
+    while (!prod_pq.empty()) {
+      // Set up level
+      prod_pq.setup_next_level();
+
+      typename Policy::label_type out_label = prod_pq.current_level();
+      std::fill(out_ids.begin(), out_ids.end(), 0u);
+
+      policy.setup_next_level(out_label);
+      in_nodes_ra.setup_next_level(out_label);
+
+      // Update maximum 1-level cut (with the cut of all outputs combined as an upper bound)
+      for (size_t i = 0u; i < outputs; ++i) {
+        out_arcs[i]->max_1level_cut = std::max(out_arcs[i]->max_1level_cut, prod_pq.size());
+      }
+
+      // Process all requests for this level
+      while (!prod_pq.empty_level()) {
+        const prod2b_many_request req = prod_pq.top();
+        const size_t i                = req.data.output;
+
+        // Seek request partially in stream
+        if (req.target[pq_idx].is_node() && req.target[pq_idx].label() == out_label) {
+          while (vs_pq[i].uid() < req.target[pq_idx] && ins_nodes_pq[i]->can_pull()) {
+            vs_pq[i] = ins_nodes_pq[i]->pull();
+          }
+
+          adiar_assert(vs_pq[i].uid() == req.target[pq_idx],
+                       "Must have found correct node in `ins_pq[i]`");
+        }
+
+        // Recreate/Obtain children of req.target (possibly of suppressed node)
+        const typename Policy::children_type children_pq = req.target[pq_idx].level() == out_label
+          ? vs_pq[i].children()
+          : Policy::reduction_rule_inv(req.target[pq_idx]);
+
+        const typename Policy::children_type children_ra = req.target[ra_idx].level() == out_label
+          ? in_nodes_ra.children(req.target[ra_idx])
+          : Policy::reduction_rule_inv(req.target[ra_idx]);
+
+        // Create pairing of product children
+        const tuple<typename Policy::pointer_type> rec_pair_0 = { children_pq[false],
+                                                                  children_ra[false] };
+
+        const tuple<typename Policy::pointer_type> rec_pair_1 = { children_pq[true],
+                                                                  children_ra[true] };
+
+        // Obtain new recursion targets
+        const prod2b_rec rec_res = policy.resolve_request(rec_pair_0, rec_pair_1);
+
+        // Forward recursion targets
+        if (Policy::no_skip || std::holds_alternative<prod2b_rec_output>(rec_res)) {
+          const prod2b_rec_output r = std::get<prod2b_rec_output>(rec_res);
+
+          adiar_assert(out_ids[i] < Policy::max_id, "Has run out of ids");
+          const node::uid_type out_uid(out_label, out_ids[i]++);
+
+          __prod2b_many_recurse_out(prod_pq, aws[i], policy, i, out_uid.as_ptr(false), r.low);
+          __prod2b_many_recurse_out(prod_pq, aws[i], policy, i, out_uid.as_ptr(true), r.high);
+
+          const __prod2b_recurse_in__output_node<Policy> handler(aws[i], out_uid);
+          request_foreach_output(prod_pq, req.target, i, handler);
+
+        } else { // std::holds_alternative<prod2b_rec_skipto>(root_rec)
+          const prod2b_rec_skipto r = std::get<prod2b_rec_skipto>(rec_res);
+          if (r[0].is_terminal() && r[1].is_terminal()) {
+            if (req.data.source.is_nil()) {
+              // Skipped in both DAGs all the way from the root until a pair of terminals.
+              res[i]             = __prod2b_terminal<Policy>(r, policy);
+              output_terminal[i] = true;
+              prod_pq.pop();
+              continue;
+            }
+
+            const typename Policy::pointer_type result = policy(r[0], r[1]);
+            const __prod2b_recurse_in__output_terminal handler(aws[i], result);
+            request_foreach_output(prod_pq, req.target, i, handler);
+          } else {
+            const __prod2b_recurse_in__forward handler(prod_pq, r);
+            request_foreach_output(prod_pq, req.target, i, handler);
+          }
+        }
+      }
+
+      // Update meta information
+      for (size_t i = 0u; i < outputs; ++i) {
+        if (out_ids[i] > 0) { aws[i].push(level_info(out_label, out_ids[i])); }
+      }
+    }
+
+    // Finalise each output
+    for (size_t i = 0u; i < outputs; ++i) {
+      if (output_terminal[i]) { continue; }
+
+      // Ensure neither the edge case, where the in-going edge from nil to the root pair, nor the
+      // cut of all outputs combined dominates the max_1level_cut
+      out_arcs[i]->max_1level_cut = std::min(aws[i].size() - out_arcs[i]->number_of_terminals[false]
+                                               - out_arcs[i]->number_of_terminals[true],
+                                             out_arcs[i]->max_1level_cut);
+
+      aws[i].close();
+      res[i] = typename Policy::__dd_type(out_arcs[i], ep);
+    }
+    return res;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  std::vector<typename Policy::__dd_type>
+  __prod2b_ra_many(const exec_policy& ep,
+                   const std::vector<typename Policy::dd_type>& ins_pq,
+                   const typename Policy::dd_type& in_ra,
+                   Policy& policy)
+  {
+    adiar_assert(in_ra->indexable, "Common input must be indexable");
+
+    const bool internal_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
+    const bool external_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::External;
+
+    safe_size_t pq_bound_sum = 0u;
+    for (const typename Policy::dd_type& in_pq : ins_pq) {
+      pq_bound_sum = pq_bound_sum
+        + std::min({ __prod2b_ilevel_upper_bound<get_2level_cut, 2u>(in_pq, in_ra, policy),
+                     __prod2b_2level_upper_bound(in_pq, in_ra, policy),
+                     __prod2b_profile_upper_bound(in_pq, in_ra, policy),
+                     __prod2b_ilevel_upper_bound(in_pq, in_ra, policy) });
+    }
+    const size_t pq_bound = to_size(pq_bound_sum);
+
+#ifdef ADIAR_STATS
+    stats_prod2b.ra.runs += 1u;
+#endif
+
+    const size_t pq_available_memory = memory_available()
+      // Input streams
+      - ins_pq.size() * node_ifstream<>::memory_usage()
+      // Random access
+      - node_raccess::memory_usage(in_ra)
+      // Output streams
+      - ins_pq.size() * arc_ofstream::memory_usage();
+
+    const size_t pq_memory_fits =
+      prod_many_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>::memory_fits(
+        pq_available_memory);
+
+    const size_t max_pq_size = internal_only ? std::min(pq_memory_fits, pq_bound) : pq_bound;
+
+    if (!external_only && max_pq_size <= no_lookahead_bound(2)) {
+#ifdef ADIAR_STATS
+      stats_prod2b.lpq.unbucketed += 1u;
+#endif
+      using pq_type = prod_many_priority_queue_t<0, memory_mode::Internal>;
+      return __prod2b_ra_many<Policy, pq_type>(
+        ep, ins_pq, in_ra, policy, pq_available_memory, max_pq_size);
+    } else if (!external_only && max_pq_size <= pq_memory_fits) {
+#ifdef ADIAR_STATS
+      stats_prod2b.lpq.internal += 1u;
+#endif
+      using pq_type = prod_many_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>;
+      return __prod2b_ra_many<Policy, pq_type>(
+        ep, ins_pq, in_ra, policy, pq_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_prod2b.lpq.hybrid += 1u;
+#endif
+      using pq_type = prod_many_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>;
+      return __prod2b_ra_many<Policy, pq_type>(
+        ep, ins_pq, in_ra, policy, pq_available_memory, max_pq_size);
+    } else {
+#ifdef ADIAR_STATS
+      stats_prod2b.lpq.external += 1u;
+#endif
+      using pq_type = prod_many_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>;
+      return __prod2b_ra_many<Policy, pq_type>(
+        ep, ins_pq, in_ra, policy, pq_available_memory, max_pq_size);
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Multi-root 2-ary Product Construction algorithm
+  ///
+  /// \details Trivial cases, e.g. terminals, are resolved one-by-one with `prod2b`. The remaining
+  ///          products are computed in batches of shared sweeps, such that the streams of a batch
+  ///          fit into half of the memory not used for random access on `in_1`. If `in_1` is not
+  ///          indexable, its levels do not fit into memory, or the execution policy requires
+  ///          priority queues, then each product is computed one-by-one with `prod2b` instead.
+  ///
+  /// \return  A class that inherits from `__dd` and describes the product of each DAG in `ins_0`
+  ///          with `in_1`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  std::vector<typename Policy::__dd_type>
+  prod2b_many(const exec_policy& ep,
+              const std::vector<typename Policy::dd_type>& ins_0,
+              const typename Policy::dd_type& in_1,
+              const Policy& policy)
+  {
+    std::vector<typename Policy::__dd_type> res(ins_0.size());
+
+    // ---------------------------------------------------------------------------------------------
+    // Case: Common random access is (not) possible.
+    const bool use_ra = !dd_isterminal(in_1) && in_1->indexable
+      && ep.template get<exec_policy::access>() != exec_policy::access::Priority_Queue
+      && node_raccess::memory_usage(in_1) <= memory_available() / 2;
+
+    // ---------------------------------------------------------------------------------------------
+    // Case: Resolve trivial products one-by-one (with a copy of the policy, since `prod2b` may
+    //       flip its operator).
+    std::vector<size_t> shared;
+    for (size_t i = 0u; i < ins_0.size(); ++i) {
+      const bool same_file =
+        ins_0[i].file_ptr() == in_1.file_ptr() && ins_0[i].shift() == in_1.shift();
+
+      if (!use_ra || same_file || dd_isterminal(ins_0[i])) {
+        Policy p = policy;
+        res[i]   = prod2b(ep, ins_0[i], in_1, p);
+      } else {
+        shared.push_back(i);
+      }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // Case: Do the product constructions in batches of shared sweeps.
+    const size_t streams_memory = node_ifstream<>::memory_usage() + arc_ofstream::memory_usage();
+    const size_t batch_size     = std::max<size_t>(
+      1u, ((memory_available() - node_raccess::memory_usage(in_1)) / 2u) / streams_memory);
+
+    for (size_t begin = 0u; begin < shared.size(); begin += batch_size) {
+      const size_t end = std::min(begin + batch_size, shared.size());
+
+      std::vector<typename Policy::dd_type> batch;
+      batch.reserve(end - begin);
+      for (size_t j = begin; j < end; ++j) { batch.push_back(ins_0[shared[j]]); }
+
+      Policy p = policy;
+      const std::vector<typename Policy::__dd_type> batch_res =
+        __prod2b_ra_many<Policy>(ep, batch, in_1, p);
+
+      for (size_t j = begin; j < end; ++j) { res[shared[j]] = batch_res[j - begin]; }
+    }
+    return res;
+  }
 }
 
 #endif // ADIAR_INTERNAL_ALGORITHMS_PROD2B_H
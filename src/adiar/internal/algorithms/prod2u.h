@@ -5,6 +5,7 @@
 
 #include <adiar/internal/algorithms/nested_sweeping.h>
 #include <adiar/internal/assert.h>
+#include <adiar/internal/cut_profile.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
 #include <adiar/internal/data_types/request.h>
 #include <adiar/internal/data_types/tuple.h>
@@ -82,6 +83,36 @@ namespace adiar::internal
     return to_size(max_cut_internal * max_cut_terminals + ConstSizeInc);
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Derives an upper bound on the output's maximum 2-level cut similar to the one above.
+  ///        But, the cuts are only multiplied with the ones on the same level.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename In>
+  size_t
+  __prod2u_profile_upper_bound(const In& in)
+  {
+    const cut ct_terminals = Policy::cut_with_terminals();
+
+    const size_t terminal_arcs = (ct_terminals.includes(false) ? in.number_of_terminals(false) : 0u)
+      + (ct_terminals.includes(true) ? in.number_of_terminals(true) : 0u);
+
+    const cut::size_type max_cut_terminals = in.max_2level_cut(ct_terminals);
+
+    cut_profile profile(in);
+
+    size_t result = 0u;
+    while (profile.has_next()) {
+      profile.seek(profile.next_level());
+
+      const safe_size_t cut_internal  = profile.max_2level_cut();
+      const safe_size_t cut_terminals = std::min<cut::size_type>(
+        to_size(cut_internal + terminal_arcs), max_cut_terminals);
+
+      result = std::max(result, to_size(cut_internal * cut_terminals + 2u));
+    }
+    return result;
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Derives an upper bound on the output's maximum i-level cut given its size.
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -301,10 +332,10 @@ namespace adiar::internal
                      "Level of requests always ought to match the one currently processed");
 
         const typename Policy::children_type children_fst =
-          in_nodes.at(req.target.first()).children();
+          in_nodes.children(req.target.first());
 
         const typename Policy::children_type children_snd = req.target.second().level() == out_label
-          ? in_nodes.at(req.target.second()).children()
+          ? in_nodes.children(req.target.second())
           : Policy::reduction_rule_inv(req.target.second());
 
         // -----------------------------------------------------------------------------------------
@@ -579,6 +610,7 @@ namespace adiar::internal
       ep.template get<exec_policy::memory>() == exec_policy::memory::External;
 
     const size_t pq_bound = std::min({ __prod2u_ilevel_upper_bound<Policy, get_2level_cut, 2u>(in),
+                                       __prod2u_profile_upper_bound<Policy>(in),
                                        __prod2u_ilevel_upper_bound(in) });
 
     const size_t max_pq_size = internal_only ? std::min(pq_memory_fits, pq_bound) : pq_bound;
@@ -596,6 +628,13 @@ namespace adiar::internal
 #endif
       using PriorityQueue = PriorityQueueTemplate<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>;
 
+      return __prod2u_ra<NodeRandomAccess, PriorityQueue>(ep, in, policy, pq_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_prod2u.lpq.hybrid += 1u;
+#endif
+      using PriorityQueue = PriorityQueueTemplate<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>;
+
       return __prod2u_ra<NodeRandomAccess, PriorityQueue>(ep, in, policy, pq_memory, max_pq_size);
     } else {
 #ifdef ADIAR_STATS
@@ -689,6 +728,7 @@ namespace adiar::internal
 
     const size_t pq_1_bound =
       std::min({ __prod2u_ilevel_upper_bound<Policy, get_2level_cut, 2u>(in),
+                 __prod2u_profile_upper_bound<Policy>(in),
                  __prod2u_ilevel_upper_bound(in) });
 
     const size_t max_pq_1_size =
@@ -718,6 +758,18 @@ namespace adiar::internal
 
       return __prod2u_pq<NodeStream, PriorityQueue_1, PriorityQueue_2>(
         ep, in, policy, pq_1_internal_memory, max_pq_1_size, pq_2_internal_memory, max_pq_2_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_prod2u.lpq.hybrid += 1u;
+#endif
+      using PriorityQueue_1 = PriorityQueue_1_Template<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>;
+      using PriorityQueue_2 = prod2u_priority_queue_2_t<memory_mode::Hybrid>;
+
+      const size_t pq_1_memory = aux_available_memory / 2;
+      const size_t pq_2_memory = pq_1_memory;
+
+      return __prod2u_pq<NodeStream, PriorityQueue_1, PriorityQueue_2>(
+        ep, in, policy, pq_1_memory, max_pq_1_size, pq_2_memory, max_pq_2_size);
     } else {
 #ifdef ADIAR_STATS
       stats_prod2u.lpq.external += 1u;
@@ -829,8 +881,9 @@ namespace adiar::internal
              const size_t /*outer_roots*/) const
     {
       const typename Policy::dd_type outer_wrapper(outer_file);
-      return std::min(__prod2u_ilevel_upper_bound<Policy, get_2level_cut, 2u>(outer_wrapper),
-                      __prod2u_ilevel_upper_bound(outer_wrapper));
+      return std::min({ __prod2u_ilevel_upper_bound<Policy, get_2level_cut, 2u>(outer_wrapper),
+                        __prod2u_profile_upper_bound<Policy>(outer_wrapper),
+                        __prod2u_ilevel_upper_bound(outer_wrapper) });
     }
 
   public:
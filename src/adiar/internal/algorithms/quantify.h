@@ -306,6 +306,9 @@ namespace adiar::internal
     /// \brief Number of *shallow* to-be quantified levels, i.e. the first N/3 nodes.
     size_t quant_shallow_vars = 0u;
 
+    /// \brief Accumulated number of nodes below each to-be quantified level.
+    size_t quant_below_size = 0u;
+
     struct var_data
     {
       /// \brief The to-be quantified variable.
@@ -370,6 +373,7 @@ namespace adiar::internal
       if (pred(li.label()) == Policy::quantify_onset) {
         res.quant_all_vars += 1u;
         res.quant_all_size += li.width();
+        res.quant_below_size += nodes_below;
         res.quant_deep_vars += nodes_below < shallow_threshold;
         res.quant_shallow_vars += nodes_above <= shallow_threshold;
 
@@ -394,6 +398,97 @@ namespace adiar::internal
     return res;
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Strategies to quantify multiple variables given by a predicate.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  enum class quantify__strategy : char
+  {
+    /** Repeated single-variable sweeps, deepest variable first. */
+    Singleton,
+    /** Nested Sweeping after a pruning transposition. */
+    Nested__Pruning,
+    /** Nested Sweeping after quantifying the deepest variable with a single-variable sweep. */
+    Nested__Singleton
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief A strategy together with its predicted cost.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  struct quantify__plan
+  {
+    /// \brief The strategy to use.
+    quantify__strategy strategy;
+
+    /// \brief Predicted number of nodes processed by all sweeps.
+    size_t cost;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Predict the cost of each strategy and pick the cheapest one.
+  ///
+  /// \details The cost of a strategy is the number of nodes processed by all of its sweeps. With N
+  ///          nodes, k to-be quantified levels, and B nodes below all of these levels in total:
+  ///
+  ///          - `Singleton` has k sweeps over the entire diagram. Each sweep may create new nodes
+  ///            for pairs of arcs; we bound the growth of each sweep with the maximum 2-level cut,
+  ///            C, i.e. the i'th sweep costs N + i*C.
+  ///
+  ///          - `Nested__Pruning` has a transposition and an outer sweep over the entire diagram and
+  ///            each inner sweep only processes the nodes below its level, i.e. 2N + B.
+  ///
+  ///          - `Nested__Singleton` merges the transposition with the sweep for the deepest level,
+  ///            which may grow the diagram by C but saves the inner sweep below it, i.e.
+  ///            2N + C + B - B', where B' are the nodes below the deepest level.
+  ///
+  /// \see quantify__pred_profile
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  inline quantify__plan
+  __quantify__auto(const typename Policy::dd_type& dd, const quantify__pred_profile<Policy>& pp)
+  {
+    adiar_assert(0u < pp.quant_all_vars, "Decision only needed if there is something to do");
+
+    // Compute costs as doubles to not worry about overflow for (very) large diagrams.
+    const double N = pp.dd_size;
+    const double k = pp.quant_all_vars;
+    const double B = pp.quant_below_size;
+    const double C = std::min<double>(dd.max_2level_cut(cut::Internal), N);
+
+    const double cost_singleton         = k * N + C * (k * (k - 1.0)) / 2.0;
+    const double cost_nested__pruning   = 2.0 * N + B;
+    const double cost_nested__singleton = 2.0 * N + C + B - pp.deepest_var.nodes_below;
+
+    quantify__plan res{ quantify__strategy::Singleton, 0u };
+    double res_cost = cost_singleton;
+
+    if (cost_nested__pruning < res_cost) {
+      res      = { quantify__strategy::Nested__Pruning, 0u };
+      res_cost = cost_nested__pruning;
+    }
+    if (cost_nested__singleton < res_cost) {
+      res      = { quantify__strategy::Nested__Singleton, 0u };
+      res_cost = cost_nested__singleton;
+    }
+
+    constexpr double max_cost = static_cast<double>(std::numeric_limits<size_t>::max());
+    res.cost =
+      res_cost < max_cost ? static_cast<size_t>(res_cost) : std::numeric_limits<size_t>::max();
+
+    return res;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether there is enough memory for Nested Sweeping (possibly with degraded priority
+  ///        queues). Otherwise, one has to fall back to repeated single-variable sweeps.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  inline bool
+  __quantify__nested_fits()
+  {
+    return nested_sweeping::memory_minimum<multi_quantify_policy__pred<Policy>>()
+      <= memory_available();
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Obtain the deepest level that satisfies (or not) the requested level.
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -443,17 +538,75 @@ namespace adiar::internal
     }
 
     // ---------------------------------------------------------------------------------------------
-    // Case: Only one variable to quantify
-    //
-    // TODO: pred_profile.quant_all_vars == 1u
+    // Case: Pick strategy
+    [[maybe_unused]] const bool is_auto =
+      ep.template get<exec_policy::quantify::algorithm>() == exec_policy::quantify::Auto;
+
+    quantify__strategy strategy;
 
     switch (ep.template get<exec_policy::quantify::algorithm>()) {
     case exec_policy::quantify::Singleton: {
+      strategy = quantify__strategy::Singleton;
+      break;
+    }
+    case exec_policy::quantify::Nested: {
+      strategy = quantify__strategy::Nested__Pruning;
+      break;
+    }
+    case exec_policy::quantify::Auto: {
+      const quantify__plan plan = __quantify__auto<Policy>(dd, pred_profile);
+      strategy                  = plan.strategy;
+#ifdef ADIAR_STATS
+      stats_quantify.automatic.predicted_cost += plan.cost;
+      switch (strategy) {
+      case quantify__strategy::Singleton: {
+        stats_quantify.automatic.singleton += 1u;
+        break;
+      }
+      case quantify__strategy::Nested__Pruning: {
+        stats_quantify.automatic.nested_pruning += 1u;
+        break;
+      }
+      case quantify__strategy::Nested__Singleton: {
+        stats_quantify.automatic.nested_singleton += 1u;
+        break;
+      }
+      }
+#endif
+      break;
+    }
+
+      // LCOV_EXCL_START
+    default:
+      // -------------------------------------------------------------------------------------------
+      adiar_unreachable();
+      // LCOV_EXCL_STOP
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // Case: Too little memory for Nested Sweeping
+    if (strategy != quantify__strategy::Singleton && !__quantify__nested_fits<Policy>()) {
+#ifdef ADIAR_STATS
+      stats_quantify.low_memory += 1u;
+#endif
+      strategy = quantify__strategy::Singleton;
+    }
+
+#ifdef ADIAR_STATS
+    // The cost of the nested sweeps' inner sweeps is derived from their statistics.
+    const uintwide inner_size_before = nested_sweeping::stats.inner_down.inputs.acc_size;
+#endif
+
+    switch (strategy) {
+    case quantify__strategy::Singleton: {
       // -------------------------------------------------------------------------------------------
       // Case: Repeated single variable quantification
       typename Policy::label_type label = pred_profile.deepest_var.level;
 
       while (label <= Policy::max_label) {
+#ifdef ADIAR_STATS
+        if (is_auto) { stats_quantify.automatic.actual_cost += dd_nodecount(dd); }
+#endif
         dd = quantify<Policy>(ep, dd, label);
 #ifdef ADIAR_STATS
         // HACK: Undo the += 1 in the nested call
@@ -466,20 +619,59 @@ namespace adiar::internal
       return dd;
     }
 
-    case exec_policy::quantify::Nested: {
+    case quantify__strategy::Nested__Pruning: {
       // -------------------------------------------------------------------------------------------
       // Case: Nested Sweeping
 #ifdef ADIAR_STATS
       stats_quantify.nested_transposition.pruning += 1u;
+      if (is_auto) { stats_quantify.automatic.actual_cost += dd_nodecount(dd); }
 #endif
       pruning_quantify_policy<Policy> pruning_impl(pred);
       const unreduced_t transposed = select(ep, std::move(dd), pruning_impl);
 
 #ifdef ADIAR_STATS
       stats_quantify.nested_sweeps += 1u;
+      if (is_auto) { stats_quantify.automatic.actual_cost += transposed.size(); }
 #endif
       multi_quantify_policy__pred<Policy> inner_impl(pred);
-      return nested_sweep<>(ep, std::move(transposed), inner_impl);
+      const unreduced_t out = nested_sweep<>(ep, std::move(transposed), inner_impl);
+
+#ifdef ADIAR_STATS
+      if (is_auto) {
+        stats_quantify.automatic.actual_cost +=
+          nested_sweeping::stats.inner_down.inputs.acc_size - inner_size_before;
+      }
+#endif
+      return out;
+    }
+
+    case quantify__strategy::Nested__Singleton: {
+      // -------------------------------------------------------------------------------------------
+      // Case: Nested Sweeping after quantifying the deepest variable
+#ifdef ADIAR_STATS
+      if (is_auto) { stats_quantify.automatic.actual_cost += dd_nodecount(dd); }
+#endif
+      const unreduced_t transposed = quantify<Policy>(ep, dd, pred_profile.deepest_var.level);
+
+#ifdef ADIAR_STATS
+      stats_quantify.nested_transposition.singleton += 1u;
+      stats_quantify.nested_sweeps += 1u;
+      // HACK: Undo the two += 1 in the nested call
+      stats_quantify.runs -= 1u;
+      stats_quantify.singleton_sweeps -= 1u;
+
+      if (is_auto) { stats_quantify.automatic.actual_cost += transposed.size(); }
+#endif
+      multi_quantify_policy__pred<Policy> inner_impl(pred);
+      const unreduced_t out = nested_sweep<>(ep, std::move(transposed), inner_impl);
+
+#ifdef ADIAR_STATS
+      if (is_auto) {
+        stats_quantify.automatic.actual_cost +=
+          nested_sweeping::stats.inner_down.inputs.acc_size - inner_size_before;
+      }
+#endif
+      return out;
     }
 
       // LCOV_EXCL_START
@@ -503,14 +695,21 @@ namespace adiar::internal
       return quantify<Policy>(ep, typename Policy::dd_type(std::move(__dd)), pred);
     }
 
+    case exec_policy::quantify::Auto:
     case exec_policy::quantify::Nested: {
       // -------------------------------------------------------------------------------------------
       // Case: Nested Sweeping
-      if (__dd.template has<typename Policy::shared_node_file_type>()) {
+      if (__dd.template has<typename Policy::shared_node_file_type>()
+          || !__quantify__nested_fits<Policy>()) {
         return quantify<Policy>(ep, typename Policy::dd_type(std::move(__dd)), pred);
       }
 
+      // The unreduced input is already transposed. Hence, Nested Sweeping is always cheaper than
+      // first reducing it for the repeated single-variable sweeps.
 #ifdef ADIAR_STATS
+      if (ep.template get<exec_policy::quantify::algorithm>() == exec_policy::quantify::Auto) {
+        stats_quantify.automatic.nested_unpredicted += 1u;
+      }
       stats_quantify.runs += 1u;
       stats_quantify.nested_transposition.none += 1u;
       stats_quantify.nested_sweeps += 1u;
@@ -624,6 +823,16 @@ namespace adiar::internal
            typename Policy::dd_type dd,
            const typename multi_quantify_policy__generator<Policy>::generator_t& lvls)
   {
+    // ---------------------------------------------------------------------------------------------
+    // Case: Too little memory for Nested Sweeping
+    if (ep.template get<exec_policy::quantify::algorithm>() != exec_policy::quantify::Singleton
+        && !__quantify__nested_fits<Policy>()) {
+#ifdef ADIAR_STATS
+      stats_quantify.low_memory += 1u;
+#endif
+      return quantify<Policy>(ep & exec_policy::quantify::Singleton, dd, lvls);
+    }
+
 #ifdef ADIAR_STATS
     stats_quantify.runs += 1u;
 #endif
@@ -708,6 +917,17 @@ namespace adiar::internal
       }
     }
 
+    case exec_policy::quantify::Auto:
+      // -------------------------------------------------------------------------------------------
+      // Case: Automatic
+      //
+      // The generator can only be used once. Hence, one cannot obtain a profile of the levels (as
+      // for predicates) without storing all of them.
+#ifdef ADIAR_STATS
+      stats_quantify.automatic.nested_unpredicted += 1u;
+#endif
+      [[fallthrough]];
+
     case exec_policy::quantify::Nested: {
       // -------------------------------------------------------------------------------------------
       // Case: Nested Sweeping
@@ -807,14 +1027,19 @@ namespace adiar::internal
       // Case: Repeated single variable quantification
       return quantify<Policy>(ep, typename Policy::dd_type(std::move(__dd)), lvls);
     }
+    case exec_policy::quantify::Auto:
     case exec_policy::quantify::Nested: {
       // -------------------------------------------------------------------------------------------
       // Case: Nested Sweeping
-      if (__dd.template has<typename Policy::shared_node_file_type>()) {
+      if (__dd.template has<typename Policy::shared_node_file_type>()
+          || !__quantify__nested_fits<Policy>()) {
         return quantify<Policy>(ep, typename Policy::dd_type(std::move(__dd)), lvls);
       }
 
 #ifdef ADIAR_STATS
+      if (ep.template get<exec_policy::quantify::algorithm>() == exec_policy::quantify::Auto) {
+        stats_quantify.automatic.nested_unpredicted += 1u;
+      }
       stats_quantify.runs += 1u;
       stats_quantify.nested_transposition.none += 1u;
       stats_quantify.nested_sweeps += 1u;
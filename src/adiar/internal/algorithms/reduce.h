@@ -71,6 +71,14 @@ namespace adiar::internal
       // least-significant bit on the source variable.
       return a.source() > b.source();
     }
+
+    static constexpr size_t radix_words = 1u;
+
+    static uint64_t
+    radix_key(const arc& a, size_t /*w*/)
+    {
+      return ~a.source().raw();
+    }
   };
 
   ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -181,6 +189,23 @@ namespace adiar::internal
 #endif
         ;
     }
+
+    // Descending on the (unflagged) children, i.e. ascending on their complement.
+#ifndef NDEBUG
+    static constexpr size_t radix_words = 3u;
+#else
+    static constexpr size_t radix_words = 2u;
+#endif
+
+    static uint64_t
+    radix_key(const node& n, size_t w)
+    {
+      switch (w) {
+      case 0u: return ~unflag(n.high()).raw();
+      case 1u: return ~unflag(n.low()).raw();
+      default: return ~n.uid().raw();
+      }
+    }
   };
 
   struct reduce_uid_lt
@@ -190,6 +215,14 @@ namespace adiar::internal
     {
       return a.old_uid > b.old_uid;
     }
+
+    static constexpr size_t radix_words = 1u;
+
+    static uint64_t
+    radix_key(const mapping& m, size_t /*w*/)
+    {
+      return ~m.old_uid.raw();
+    }
   };
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -361,9 +394,7 @@ namespace adiar::internal
       red2_mapping.push({ next_node.uid(), out_node.uid() });
     }
 
-    // Add number of nodes to level information, if any nodes were pushed to the output.
     const size_t reduced_width = Policy::max_id - out_id;
-    if (reduced_width > 0) { out.unsafe_push(level_info(out_label, reduced_width)); }
 
     // Sort mappings for Reduction rule 2 back in order of arcs.internal
     red2_mapping.sort();
@@ -380,6 +411,9 @@ namespace adiar::internal
     bool has_next_red2 = red2_mapping.can_pull();
     if (has_next_red2) { next_red2 = red2_mapping.pull(); }
 
+    // Number of arcs into this level, i.e. the ones that are not redirected by Reduction Rule 1.
+    size_t level_indegree = 0u;
+
     // Pass all the mappings to Q
     while (has_next_red1 || has_next_red2) {
       // Find the mapping with largest old_uid
@@ -403,6 +437,8 @@ namespace adiar::internal
 
         adiar_assert(t.is_terminal() || t.out_idx() == false, "Created target is without an index");
         reduce_pq.push(arc(s, t));
+
+        level_indegree += !is_red1_current;
       }
 
       // Update the mapping that was used
@@ -418,6 +454,16 @@ namespace adiar::internal
     // Move on to the next level
     red1_mapping.close();
 
+    // Add number of nodes (and the 2-level cut with the level below) to level information, if any
+    // nodes were pushed to the output. Any such cut is crossed by at most the arcs into, out of,
+    // and past this level as well as the arcs out of the level below.
+    if (reduced_width > 0) {
+      const size_t level_2level_cut =
+        local_1level_cut[cut::Internal] + level_indegree + out.unsafe_outdegree_below();
+
+      out.unsafe_push(level_info(out_label, reduced_width, level_2level_cut));
+    }
+
     // Update with new possible maximum 1-level cut (the one below the current level)
     out.unsafe_max_1level_cut(local_1level_cut);
 
@@ -559,7 +605,7 @@ namespace adiar::internal
 
         out.unsafe_push(node(out_level, Policy::max_id, e_low.target(), e_high.target()));
 
-        out.unsafe_push(level_info(out_level, 1u));
+        out.unsafe_push(level_info(out_level, 1u, 0u));
 
         out_file->max_1level_cut[cut::Internal] = 1u;
 
@@ -674,6 +720,12 @@ namespace adiar::internal
 #endif
       return __reduce<Policy, reduce_priority_queue<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
         policy, in_file, pq_memory, sorters_memory);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_reduce.lpq.hybrid += 1u;
+#endif
+      return __reduce<Policy, reduce_priority_queue<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>>(
+        policy, in_file, pq_memory, sorters_memory);
     } else {
 #ifdef ADIAR_STATS
       stats_reduce.lpq.external += 1u;
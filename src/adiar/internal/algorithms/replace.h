@@ -188,6 +188,8 @@ namespace adiar::internal
         dd->max_1level_cut[dd.is_negated() ? cut::Internal_False : cut::Internal_True],
         dd->max_1level_cut[cut::All] });
 
+    out.unsafe_set_level_cut_slack(dd->level_cut_slack);
+
     { // Copy over nodes (in "reverse" to still follow the same order on disk)
       node_ifstream<true> in_nodes(dd);
       while (in_nodes.can_pull()) { out.unsafe_push(__replace(in_nodes.pull(), m)); }
@@ -196,7 +198,9 @@ namespace adiar::internal
       level_info_ifstream<true> in_levels(dd);
       while (in_levels.can_pull()) {
         const level_info li = in_levels.pull();
-        out.unsafe_push(level_info(m(li.level()), li.width()));
+        out.unsafe_push(li.has_max_2level_cut()
+                          ? level_info(m(li.level()), li.width(), li.max_2level_cut())
+                          : level_info(m(li.level()), li.width()));
       }
     }
 
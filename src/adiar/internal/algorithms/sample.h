@@ -0,0 +1,463 @@
+#ifndef ADIAR_INTERNAL_ALGORITHMS_SAMPLE_H
+#define ADIAR_INTERNAL_ALGORITHMS_SAMPLE_H
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdint.h>
+
+#include <tpie/array.h>
+
+#include <adiar/exec_policy.h>
+#include <adiar/functional.h>
+
+#include <adiar/internal/algorithms/count.h>
+#include <adiar/internal/assert.h>
+#include <adiar/internal/data_structures/levelized_priority_queue.h>
+#include <adiar/internal/data_types/arc.h>
+#include <adiar/internal/data_types/ptr.h>
+#include <adiar/internal/data_types/request.h>
+#include <adiar/internal/dd_func.h>
+#include <adiar/internal/io/arc_file.h>
+#include <adiar/internal/io/arc_ifstream.h>
+#include <adiar/internal/io/file.h>
+#include <adiar/internal/io/ifstream.h>
+#include <adiar/internal/io/levelized_ifstream.h>
+#include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/io/ofstream.h>
+#include <adiar/internal/io/shared_file_ptr.h>
+#include <adiar/internal/util.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////
+  //  Sample Algorithm
+  // ==================
+  //
+  // Draws uniformly random satisfying assignments from a Binary Decision
+  // Diagram. This is done with two sweeps:
+  //
+  // 1. A bottom-up sweep (similar to Reduce) computes for each node the
+  //    (log2 of the) number of satisfying assignments below it. From this, the
+  //    probability of taking the high edge is derived and written to a file.
+  //
+  // 2. A top-down sweep (similar to Count) moves all samples at once through
+  //    the diagram, choosing at each node the high edge with the probability
+  //    computed in the first sweep.
+  //
+  // Levels that are skipped by an edge are don't cares and assigned uniformly
+  // at random.
+  //
+  // The number of assignments is kept as a logarithm in base 2 to not overflow
+  // on diagrams with many levels (at the cost of some precision).
+  //
+  // Both sweeps account for their priority queues in `stats_count`.
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Data structures (bottom-up)
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   An arc annotated with the (logarithmic) weight of its target.
+  ///
+  /// \details If the target is on the i'th of L levels and has w satisfying
+  ///          assignments to its levels below, then the weight is `log2(w) + i`.
+  ///          This makes the weight independent of the source; the number of
+  ///          skipped levels cancels out when comparing both children.
+  //////////////////////////////////////////////////////////////////////////////
+  struct sample_arc
+  {
+    /// Source of the arc (including its out-index).
+    ptr_uint64 source;
+
+    /// Logarithmic weight of the arc's target.
+    double weight;
+
+    /// The level of the arc's source.
+    ptr_uint64::label_type
+    level() const
+    {
+      return source.label();
+    }
+  };
+
+  struct sample_arc_lt
+  {
+    bool
+    operator()(const sample_arc& a, const sample_arc& b)
+    {
+      // Same as in Reduce: the high arc is placed before the low arc.
+      return a.source > b.source;
+    }
+  };
+
+  template <size_t look_ahead, memory_mode mem_mode>
+  using sample_weights_priority_queue_t =
+    levelized_arc_priority_queue<sample_arc, sample_arc_lt, look_ahead, mem_mode>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Data structures (top-down)
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// Auxiliary data for the Priority Queue in the top-down sweep.
+  //////////////////////////////////////////////////////////////////////////////
+  struct sample_data
+  {
+    static constexpr bool sort_on_tiebreak = true;
+    static constexpr bool has_level        = false;
+
+    /// Index of the sample.
+    uint64_t sample;
+
+    /// Index of the first level (in the diagram) not yet assigned.
+    ptr_uint64::label_type next_level_idx;
+
+    /// Sorting predicate (to make the output independent of the priority queue).
+    inline bool
+    operator<(const sample_data& o) const
+    {
+      return this->sample < o.sample;
+    }
+  };
+
+  template <size_t look_ahead, memory_mode mem_mode>
+  using sample_priority_queue_t = count_priority_queue_t<sample_data, look_ahead, mem_mode>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Helper functions
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Logarithm of the sum of two logarithmic weights, i.e. `log2(2^a + 2^b)`.
+  //////////////////////////////////////////////////////////////////////////////
+  inline double
+  __sample_log2_add(const double a, const double b)
+  {
+    if (a == -std::numeric_limits<double>::infinity()) { return b; }
+    if (b == -std::numeric_limits<double>::infinity()) { return a; }
+
+    const double max = std::max(a, b);
+    const double min = std::min(a, b);
+    return max + std::log2(1.0 + std::exp2(min - max));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the next arc for the current level (see `__reduce_get_next`).
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename PriorityQueue>
+  inline sample_arc
+  __sample_get_next(PriorityQueue& pq, arc_ifstream<>& arcs, const double true_weight)
+  {
+    if (!pq.can_pull()
+        || (arcs.can_pull_terminal() && arcs.peek_terminal().source() > pq.top().source)) {
+      const arc a = arcs.pull_terminal();
+      return { a.source(),
+               a.target().value() ? true_weight : -std::numeric_limits<double>::infinity() };
+    } else {
+      return pq.pull();
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename PriorityQueue>
+  shared_file<double>
+  __sample_weights(const shared_levelized_file<arc>& af,
+                   const ptr_uint64::label_type varcount,
+                   const size_t pq_max_memory,
+                   const size_t pq_max_size)
+  {
+    // Set up output
+    shared_file<double> out_file;
+    ofstream<double> out(out_file);
+
+    // Set up input
+    arc_ifstream<> arcs(af);
+    level_info_ifstream<> levels(af);
+
+    PriorityQueue pq({ af }, pq_max_memory, pq_max_size, stats_count.lpq);
+
+    // The weight of the true terminal, i.e. log2(1) + varcount
+    const double true_weight = static_cast<double>(varcount);
+
+    // Process bottom-up each level
+    while (levels.can_pull()) {
+      const ptr_uint64::label_type level = levels.pull().level();
+
+      adiar_assert(!pq.has_current_level() || level == pq.current_level(),
+                   "level and priority queue should be in sync");
+
+      while ((arcs.can_pull_terminal() && arcs.peek_terminal().source().label() == level)
+             || pq.can_pull()) {
+        const sample_arc e_high = __sample_get_next(pq, arcs, true_weight);
+        const sample_arc e_low  = __sample_get_next(pq, arcs, true_weight);
+
+        adiar_assert(essential(e_low.source) == essential(e_high.source),
+                     "Both arcs stem from the same node");
+
+        // Probability of the high edge, i.e. 2^high / (2^low + 2^high). If only one edge leads to
+        // the true terminal, then this is exactly 0 or 1.
+        const double p_high = 1.0 / (1.0 + std::exp2(e_low.weight - e_high.weight));
+        out << p_high;
+
+        // Weight of this node. The division by two (subtraction by one) accounts for the node's
+        // own level, i.e. moving one level up.
+        const double weight = __sample_log2_add(e_low.weight, e_high.weight) - 1.0;
+        adiar_assert(weight != -std::numeric_limits<double>::infinity(),
+                     "A reduced diagram has no nodes without any satisfying assignments");
+
+        // Forward weight to all parents
+        const ptr_uint64 uid = essential(e_low.source);
+        while (arcs.can_pull_internal() && arcs.peek_internal().target() == uid) {
+          pq.push({ arcs.pull_internal().source(), weight });
+        }
+      }
+
+      if (!pq.empty()) {
+        if (arcs.can_pull_terminal()) {
+          pq.setup_next_level(arcs.peek_terminal().source().label());
+        } else {
+          pq.setup_next_level();
+        }
+      }
+    }
+
+    return out_file;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Compute for each node (in descending order) the probability of its
+  ///        high edge in a uniformly random satisfying assignment.
+  ///
+  /// \pre `!dd_isterminal(dd)`
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  shared_file<double>
+  sample_weights(const exec_policy& ep, const typename Policy::dd_type& dd)
+  {
+    adiar_assert(!dd_isterminal(dd), "Sample algorithm does not work on terminal-only edge case");
+
+    const shared_levelized_file<arc> af = transpose(dd);
+
+    const size_t aux_available_memory = memory_available()
+      // Input streams
+      - arc_ifstream<>::memory_usage() - level_info_ifstream<>::memory_usage()
+      // Output streams
+      - ofstream<double>::memory_usage();
+
+    const size_t pq_memory_fits =
+      sample_weights_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>::memory_fits(
+        aux_available_memory);
+
+    const bool internal_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
+    const bool external_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::External;
+
+    const size_t pq_bound = af->max_1level_cut;
+
+    const size_t max_pq_size = internal_only ? std::min(pq_memory_fits, pq_bound) : pq_bound;
+
+    const ptr_uint64::label_type varcount = dd_varcount(dd);
+
+    if (!external_only && max_pq_size <= no_lookahead_bound(1)) {
+#ifdef ADIAR_STATS
+      stats_count.lpq.unbucketed += 1u;
+#endif
+      return __sample_weights<sample_weights_priority_queue_t<0, memory_mode::Internal>>(
+        af, varcount, aux_available_memory, max_pq_size);
+    } else if (!external_only && max_pq_size <= pq_memory_fits) {
+#ifdef ADIAR_STATS
+      stats_count.lpq.internal += 1u;
+#endif
+      return __sample_weights<
+        sample_weights_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
+        af, varcount, aux_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_count.lpq.hybrid += 1u;
+#endif
+      return __sample_weights<
+        sample_weights_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>>(
+        af, varcount, aux_available_memory, max_pq_size);
+    } else {
+#ifdef ADIAR_STATS
+      stats_count.lpq.external += 1u;
+#endif
+      return __sample_weights<
+        sample_weights_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>>(
+        af, varcount, aux_available_memory, max_pq_size);
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Assign uniformly random values to the levels in `[begin, end)`.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Generator>
+  inline void
+  __sample_dont_cares(const consumer<pair<size_t, pair<ptr_uint64::label_type, bool>>>& c,
+                      Generator& gen,
+                      const uint64_t sample,
+                      const tpie::array<ptr_uint64::label_type>& levels,
+                      const ptr_uint64::label_type begin,
+                      const ptr_uint64::label_type end)
+  {
+    for (ptr_uint64::label_type i = begin; i < end; ++i) {
+      c({ sample, { levels[i], static_cast<bool>(gen() & 1u) } });
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename PriorityQueue>
+  void
+  __sample(const typename Policy::dd_type& dd,
+           const shared_file<double>& weights,
+           const size_t samples,
+           const uint64_t seed,
+           const consumer<pair<size_t, pair<typename Policy::label_type, bool>>>& c,
+           const size_t pq_max_memory,
+           const size_t pq_max_size)
+  {
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+
+    // Set up input
+    node_ifstream<> ns(dd);
+    ifstream<double, true> ws(weights);
+
+    // Set up (in-memory) lookup of the diagram's levels to resolve don't cares.
+    const typename Policy::label_type varcount = dd_varcount(dd);
+    tpie::array<typename Policy::label_type> levels(varcount);
+    {
+      level_info_ifstream<> lis(dd);
+      for (typename Policy::label_type i = 0u; lis.can_pull(); ++i) {
+        levels[i] = lis.pull().level();
+      }
+    }
+
+    // Set up cross-level priority queue with a request for the root per sample
+    PriorityQueue sample_pq({ dd }, pq_max_memory, pq_max_size, stats_count.lpq);
+    {
+      const node root = ns.peek();
+
+      for (uint64_t s = 0u; s < samples; ++s) { sample_pq.push({ { root.uid() }, {}, { s, 0u } }); }
+    }
+
+    typename Policy::label_type level_idx = 0u;
+
+    while (!sample_pq.empty()) {
+      sample_pq.setup_next_level();
+
+      while (levels[level_idx] != sample_pq.current_level()) { ++level_idx; }
+
+      while (!sample_pq.empty_level()) {
+        // Skip nodes not visited by any sample
+        node n        = ns.pull();
+        double p_high = ws.pull();
+
+        while (n.uid() < sample_pq.top().target.first()) {
+          n      = ns.pull();
+          p_high = ws.pull();
+        }
+        adiar_assert(sample_pq.top().target == n.uid(), "Node is the target of the next request");
+
+        // Move each sample onwards
+        while (sample_pq.can_pull() && sample_pq.top().target == n.uid()) {
+          const sample_data data = sample_pq.pull().data;
+
+          __sample_dont_cares(c, gen, data.sample, levels, data.next_level_idx, level_idx);
+
+          const bool value = coin(gen) < p_high;
+          c({ data.sample, { n.label(), value } });
+
+          const typename Policy::pointer_type child = value ? n.high() : n.low();
+          adiar_assert(!child.is_false(), "Never go to the false terminal");
+
+          if (child.is_true()) {
+            __sample_dont_cares(c, gen, data.sample, levels, level_idx + 1u, varcount);
+          } else {
+            sample_pq.push({ { child }, {}, { data.sample, level_idx + 1u } });
+          }
+        }
+      }
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Draw uniformly random satisfying assignments to the levels of a
+  ///        (non-terminal) diagram.
+  ///
+  /// \param samples Number of samples to draw.
+  ///
+  /// \param seed    Seed for the pseudo-random number generator.
+  ///
+  /// \param c       Consumer of pairs of the sample's index and the (label, value)
+  ///                pair. Each sample is provided in ascending order of the
+  ///                levels, but the samples are interleaved.
+  ///
+  /// \pre `!dd_isterminal(dd)`
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  void
+  sample(const exec_policy& ep,
+         const typename Policy::dd_type& dd,
+         const size_t samples,
+         const uint64_t seed,
+         const consumer<pair<size_t, pair<typename Policy::label_type, bool>>>& c)
+  {
+    adiar_assert(!dd_isterminal(dd), "Sample algorithm does not work on terminal-only edge case");
+
+    if (samples == 0u) { return; }
+
+    // Bottom-up sweep
+    const shared_file<double> weights = sample_weights<Policy>(ep, dd);
+
+    // Top-down sweep
+    const size_t aux_available_memory = memory_available()
+      // Input streams
+      - node_ifstream<>::memory_usage() - ifstream<double, true>::memory_usage()
+      - level_info_ifstream<>::memory_usage()
+      // Level lookup
+      - tpie::array<typename Policy::label_type>::memory_usage(dd_varcount(dd));
+
+    const size_t pq_memory_fits =
+      sample_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>::memory_fits(
+        aux_available_memory);
+
+    const bool internal_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
+    const bool external_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::External;
+
+    // Each sample is (at most) in one request at a time.
+    const size_t pq_bound = samples;
+
+    const size_t max_pq_size = internal_only ? std::min(pq_memory_fits, pq_bound) : pq_bound;
+
+    if (!external_only && max_pq_size <= no_lookahead_bound()) {
+#ifdef ADIAR_STATS
+      stats_count.lpq.unbucketed += 1u;
+#endif
+      __sample<Policy, sample_priority_queue_t<0, memory_mode::Internal>>(
+        dd, weights, samples, seed, c, aux_available_memory, max_pq_size);
+    } else if (!external_only && max_pq_size <= pq_memory_fits) {
+#ifdef ADIAR_STATS
+      stats_count.lpq.internal += 1u;
+#endif
+      __sample<Policy, sample_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
+        dd, weights, samples, seed, c, aux_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_count.lpq.hybrid += 1u;
+#endif
+      __sample<Policy, sample_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>>(
+        dd, weights, samples, seed, c, aux_available_memory, max_pq_size);
+    } else {
+#ifdef ADIAR_STATS
+      stats_count.lpq.external += 1u;
+#endif
+      __sample<Policy, sample_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>>(
+        dd, weights, samples, seed, c, aux_available_memory, max_pq_size);
+    }
+  }
+}
+
+#endif // ADIAR_INTERNAL_ALGORITHMS_SAMPLE_H
@@ -1,7 +1,9 @@
 #ifndef ADIAR_INTERNAL_ALGORITHMS_SELECT_H
 #define ADIAR_INTERNAL_ALGORITHMS_SELECT_H
 
+#include <algorithm>
 #include <variant>
+#include <vector>
 
 #include <adiar/exec_policy.h>
 #include <adiar/types.h>
@@ -18,6 +20,7 @@
 #include <adiar/internal/io/file.h>
 #include <adiar/internal/io/ifstream.h>
 #include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/util.h>
 
 namespace adiar::internal
 {
@@ -223,6 +226,12 @@ namespace adiar::internal
 #endif
       return __select<Policy, select_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
         ep, dd, policy, aux_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_select.lpq.hybrid += 1u;
+#endif
+      return __select<Policy, select_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>>(
+        ep, dd, policy, aux_available_memory, max_pq_size);
     } else {
 #ifdef ADIAR_STATS
       stats_select.lpq.external += 1u;
@@ -231,6 +240,277 @@ namespace adiar::internal
         ep, dd, policy, aux_available_memory, max_pq_size);
     }
   }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  //  Multi-root Select Algorithm
+  // =============================
+  //
+  // Applies the same selection to multiple Decision Diagrams within a single top-down sweep. Each
+  // request is tagged with the index of the output it belongs to. Hence, the policy is only set up
+  // once per level for all outputs while each output is read from and written to its own files.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Data Structures
+  using select_many_request = request_data<1, with_output_and_parent>;
+
+  template <size_t look_ahead, memory_mode mem_mode>
+  using select_many_priority_queue_t =
+    levelized_node_priority_queue<select_many_request,
+                                  request_data_first_lt<select_many_request>,
+                                  look_ahead,
+                                  mem_mode,
+                                  1u,
+                                  0u>;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Helper functions
+  template <typename PriorityQueue>
+  inline void
+  __select_many_recurse_out(PriorityQueue& pq,
+                            arc_ofstream& aw,
+                            const size_t output,
+                            const ptr_uint64& source,
+                            const ptr_uint64& target)
+  {
+    if (target.is_terminal()) {
+      aw.push_terminal({ source, target });
+    } else {
+      pq.push({ { target }, {}, { output, source } });
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename PriorityQueue>
+  std::vector<typename Policy::__dd_type>
+  __select_many(const exec_policy& ep,
+                const std::vector<typename Policy::dd_type>& dds,
+                Policy& policy,
+                const size_t pq_memory,
+                const size_t pq_max_size)
+  {
+    const size_t outputs = dds.size();
+
+    // Set up outputs
+    std::vector<typename Policy::__dd_type> res(outputs);
+
+    memory_vector<shared_levelized_file<arc>> out_arcs(outputs);
+    memory_vector<arc_ofstream> aws(outputs);
+
+    memory_vector<typename Policy::id_type> level_sizes(outputs, 0u);
+    memory_vector<bool> output_changes(outputs, false);
+    memory_vector<bool> output_terminal(outputs, false);
+
+    for (size_t i = 0u; i < outputs; ++i) {
+      aws[i].open(out_arcs[i]);
+      out_arcs[i]->max_1level_cut = 0;
+    }
+
+    // Set up inputs
+    memory_vector<unique_ptr<node_ifstream<>>> nss;
+    nss.reserve(outputs);
+    for (const typename Policy::dd_type& dd : dds) {
+      nss.push_back(adiar::make_unique<node_ifstream<>>(dd));
+    }
+
+    // Set up priority queue with initial requests to all roots
+    const memory_vector<typename Policy::label_type> levels = union_of_levels(dds);
+
+    PriorityQueue pq(
+      { make_generator(levels.begin(), levels.end()) }, pq_memory, pq_max_size, stats_select.lpq);
+
+    for (size_t i = 0u; i < outputs; ++i) {
+      const node root = nss[i]->peek();
+      pq.push({ { root.uid() }, {}, { i, Policy::pointer_type::nil() } });
+    }
+
+    // Process all to-be-visited nodes in topological order
+    while (!pq.empty()) {
+      // Set up next level
+      pq.setup_next_level();
+
+      const typename Policy::label_type level = pq.current_level();
+      std::fill(level_sizes.begin(), level_sizes.end(), 0u);
+
+      policy.setup_level(level);
+
+      // Update max 1-level cut (with the cut of all outputs combined as an upper bound)
+      for (size_t i = 0u; i < outputs; ++i) {
+        out_arcs[i]->max_1level_cut = std::max(out_arcs[i]->max_1level_cut, pq.size());
+      }
+
+      // Process entire level
+      while (!pq.empty_level()) {
+        const size_t i = pq.top().data.output;
+
+        // Seek requested node
+        const node n = nss[i]->seek(pq.top().target[0]);
+
+        adiar_assert(pq.top().target == n.uid());
+        adiar_assert(n.uid().label() == level);
+
+        const select_rec rec = policy.process(n);
+
+        // Output/Forward resulting node
+        if (std::holds_alternative<typename Policy::node_type>(rec)) {
+          const node rec_node = std::get<typename Policy::node_type>(rec);
+
+          if constexpr (Policy::skip_reduce) {
+            if (rec_node != n) { output_changes[i] = true; }
+          }
+
+          // Output/Forward outgoing arcs
+          __select_many_recurse_out(pq, aws[i], i, n.uid().as_ptr(false), rec_node.low());
+          __select_many_recurse_out(pq, aws[i], i, n.uid().as_ptr(true), rec_node.high());
+
+          // Output ingoing arcs
+          while (pq.can_pull() && pq.top().target == rec_node.uid()
+                 && pq.top().data.output == i) {
+            const select_many_request request_pq = pq.pull();
+
+            if (!request_pq.data.source.is_nil()) {
+              aws[i].push_internal({ request_pq.data.source, rec_node.uid() });
+            }
+          }
+
+          level_sizes[i]++;
+        } else { // std::holds_alternative<node::pointer_type>(rec_res)
+          const typename Policy::pointer_type rec_target =
+            std::get<typename Policy::pointer_type>(rec);
+
+          if constexpr (Policy::skip_reduce) { output_changes[i] = true; }
+
+          // Output/Forward extension of arc
+          while (pq.can_pull() && pq.top().target == n.uid() && pq.top().data.output == i) {
+            const typename Policy::pointer_type source = pq.pull().data.source;
+
+            if (rec_target.is_terminal() && source.is_nil()) {
+              // Edge-case: restriction to a terminal
+              res[i]             = policy.terminal(rec_target.value());
+              output_terminal[i] = true;
+              continue;
+            }
+
+            __select_many_recurse_out(pq, aws[i], i, source, rec_target);
+          }
+        }
+      }
+
+      // Push meta data about this level
+      for (size_t i = 0u; i < outputs; ++i) {
+        if (level_sizes[i] > 0) { aws[i].push(level_info(level, level_sizes[i])); }
+      }
+    }
+
+    // Finalise each output
+    for (size_t i = 0u; i < outputs; ++i) {
+      if (output_terminal[i]) { continue; }
+
+      if constexpr (Policy::skip_reduce) {
+        if (!output_changes[i]) {
+          res[i] = dds[i];
+          continue;
+        }
+      }
+
+      // Ensure the cut of all outputs combined is not worse than the number of internal arcs.
+      out_arcs[i]->max_1level_cut = std::min(aws[i].size() - out_arcs[i]->number_of_terminals[false]
+                                               - out_arcs[i]->number_of_terminals[true],
+                                             out_arcs[i]->max_1level_cut);
+
+      aws[i].close();
+      res[i] = typename Policy::__dd_type(out_arcs[i], ep);
+    }
+    return res;
+  }
+
+  template <typename Policy>
+  std::vector<typename Policy::__dd_type>
+  __select_many(const exec_policy& ep,
+                const std::vector<typename Policy::dd_type>& dds,
+                Policy& policy)
+  {
+    // Compute amount of memory available for auxiliary data structures after having opened all
+    // streams.
+    const size_t aux_available_memory = memory_available()
+      - dds.size() * (node_ifstream<>::memory_usage() + arc_ofstream::memory_usage());
+
+    const size_t pq_memory_fits =
+      select_many_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>::memory_fits(
+        aux_available_memory);
+
+    const bool internal_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
+    const bool external_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::External;
+
+    safe_size_t pq_bound_sum = 0u;
+    for (const typename Policy::dd_type& dd : dds) {
+      pq_bound_sum = pq_bound_sum + __select_2level_upper_bound<Policy>(dd);
+    }
+    const size_t pq_bound = to_size(pq_bound_sum);
+
+    const size_t max_pq_size = internal_only ? std::min(pq_memory_fits, pq_bound) : pq_bound;
+
+    if (!external_only && max_pq_size <= no_lookahead_bound(1)) {
+#ifdef ADIAR_STATS
+      stats_select.lpq.unbucketed += 1u;
+#endif
+      return __select_many<Policy, select_many_priority_queue_t<0, memory_mode::Internal>>(
+        ep, dds, policy, aux_available_memory, max_pq_size);
+    } else if (!external_only && max_pq_size <= pq_memory_fits) {
+#ifdef ADIAR_STATS
+      stats_select.lpq.internal += 1u;
+#endif
+      using pq_type = select_many_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>;
+      return __select_many<Policy, pq_type>(ep, dds, policy, aux_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_select.lpq.hybrid += 1u;
+#endif
+      using pq_type = select_many_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Hybrid>;
+      return __select_many<Policy, pq_type>(ep, dds, policy, aux_available_memory, max_pq_size);
+    } else {
+#ifdef ADIAR_STATS
+      stats_select.lpq.external += 1u;
+#endif
+      using pq_type = select_many_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>;
+      return __select_many<Policy, pq_type>(ep, dds, policy, aux_available_memory, max_pq_size);
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Select on multiple decision diagrams with shared sweeps.
+  ///
+  /// \details The outputs are processed in batches, such that the input and output streams of a
+  ///          batch fit into half of the available memory. Between batches, the policy's `reset()`
+  ///          is called to restart it from the top.
+  ///
+  /// \pre     None of the decision diagrams in `dds` are terminals.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  std::vector<typename Policy::__dd_type>
+  select_many(const exec_policy& ep,
+              const std::vector<typename Policy::dd_type>& dds,
+              Policy& policy)
+  {
+    const size_t streams_memory = node_ifstream<>::memory_usage() + arc_ofstream::memory_usage();
+    const size_t batch_size     = std::max<size_t>(1u, (memory_available() / 2u) / streams_memory);
+
+    std::vector<typename Policy::__dd_type> res;
+    res.reserve(dds.size());
+
+    for (size_t begin = 0u; begin < dds.size(); begin += batch_size) {
+      const size_t end = std::min(begin + batch_size, dds.size());
+      const std::vector<typename Policy::dd_type> batch(dds.begin() + begin, dds.begin() + end);
+
+      if (begin > 0u) { policy.reset(); }
+      for (const typename Policy::__dd_type& r : __select_many<Policy>(ep, batch, policy)) {
+        res.push_back(r);
+      }
+    }
+    return res;
+  }
 }
 
 #endif // ADIAR_INTERNAL_ALGORITHMS_SELECT_H
@@ -1,12 +1,21 @@
 #ifndef ADIAR_INTERNAL_ALGORITHMS_TRAVERSE_H
 #define ADIAR_INTERNAL_ALGORITHMS_TRAVERSE_H
 
+#include <algorithm>
+
+#include <tpie/array.h>
+
+#include <adiar/exec_policy.h>
+#include <adiar/types.h>
+
 #include <adiar/internal/assert.h>
+#include <adiar/internal/data_structures/stack.h>
 #include <adiar/internal/data_types/node.h>
 #include <adiar/internal/data_types/uid.h>
 #include <adiar/internal/dd.h>
 #include <adiar/internal/io/node_file.h>
 #include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/memory.h>
 
 namespace adiar::internal
 {
@@ -41,6 +50,202 @@ namespace adiar::internal
     if (!tgt.is_nil()) { visitor.visit(tgt.value()); }
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Entry on the stack of `traverse_paths`, i.e. a node on the current
+  ///        path, the arc to follow out of it, and its depth on the path.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Node>
+  struct traverse_paths_frame
+  {
+    Node node;
+    bool arc;
+    size_t depth;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Random access to the nodes of a diagram, by having loaded all of them
+  ///        into internal memory (in order of their uids).
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Dd>
+  class traverse_paths_array
+  {
+  public:
+    using node_type    = typename Dd::node_type;
+    using pointer_type = typename Dd::pointer_type;
+
+    static size_t
+    memory_usage(const Dd& dd)
+    {
+      return node_ifstream<>::memory_usage() + tpie::array<node_type>::memory_usage(dd->size());
+    }
+
+  private:
+    tpie::array<node_type> _nodes;
+
+  public:
+    traverse_paths_array(const Dd& dd)
+      : _nodes(dd->size())
+    {
+      node_ifstream<> in_nodes(dd);
+      for (size_t i = 0u; in_nodes.can_pull(); ++i) { _nodes[i] = in_nodes.pull(); }
+    }
+
+    pointer_type
+    root() const
+    {
+      return _nodes[0].uid();
+    }
+
+    node_type
+    at(const pointer_type& p)
+    {
+      const auto node_lt = [](const node_type& n, const pointer_type& p) { return n.uid() < p; };
+      const auto it      = std::lower_bound(_nodes.begin(), _nodes.end(), p, node_lt);
+
+      adiar_assert(it != _nodes.end() && it->uid() == p, "Node should exist in Decision Diagram");
+      return *it;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Access to the nodes of a diagram by seeking within a stream of them.
+  ///
+  /// \details A node after the read head is found by scanning forwards. A node
+  ///          before it (e.g. the high child of a node higher up on the path)
+  ///          requires the stream to be scanned again from its start.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Dd>
+  class traverse_paths_stream
+  {
+  public:
+    using node_type    = typename Dd::node_type;
+    using pointer_type = typename Dd::pointer_type;
+
+    static size_t
+    memory_usage(const Dd& /*dd*/)
+    {
+      return node_ifstream<>::memory_usage();
+    }
+
+  private:
+    node_ifstream<> _in_nodes;
+
+  public:
+    traverse_paths_stream(const Dd& dd)
+      : _in_nodes(dd)
+    {}
+
+    pointer_type
+    root()
+    {
+      _in_nodes.reset();
+      return _in_nodes.peek().uid();
+    }
+
+    node_type
+    at(const pointer_type& p)
+    {
+      if (!_in_nodes.can_pull() || p < _in_nodes.peek().uid()) { _in_nodes.reset(); }
+
+      const node_type n = _in_nodes.seek(p);
+      adiar_assert(n.uid() == p, "Node should exist in Decision Diagram");
+      return n;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename NodeAccess, typename Stack, typename Callback>
+  void
+  __traverse_paths(NodeAccess& nodes,
+                   Stack& path_stack,
+                   const size_t levels,
+                   const Callback& callback)
+  {
+    using node_type  = typename NodeAccess::node_type;
+    using label_type = typename node_type::label_type;
+
+    // The (label, value) pairs of the current path.
+    tpie::array<pair<label_type, bool>> path(levels);
+
+    path_stack.push({ nodes.at(nodes.root()), false, 0u });
+
+    while (!path_stack.empty()) {
+      const traverse_paths_frame<node_type> top = path_stack.pull();
+
+      adiar_assert(top.depth < levels, "Path cannot be longer than the number of levels");
+      path[top.depth] = { top.node.label(), top.arc };
+
+      // Revisit this node later to follow its high arc.
+      if (!top.arc) { path_stack.push({ top.node, true, top.depth }); }
+
+      const typename node_type::pointer_type child = top.node.child(top.arc);
+      if (child.is_terminal()) {
+        if (child.value()) { callback(path.get(), top.depth + 1u); }
+      } else {
+        path_stack.push({ nodes.at(child), false, top.depth + 1u });
+      }
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Depth-first traversal of all paths to the `true` terminal.
+  ///
+  /// \details The path is kept on a stack, which holds at most two entries per
+  ///          level. If it fits, all nodes are loaded into internal memory to
+  ///          be able to jump back up to a node whose high arc has yet to be
+  ///          followed. Otherwise, nodes are found by seeking within a stream;
+  ///          if even the stack does not fit, it is placed on disk. The low arc
+  ///          is always followed before the high arc.
+  ///
+  /// \param callback Function called for each path with a pointer to its
+  ///                 (label, value) pairs (in ascending order) and its length.
+  ///
+  /// \pre `!dd_isterminal(dd)`
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Dd, typename Callback>
+  void
+  traverse_paths(const exec_policy& ep, const Dd& dd, const Callback& callback)
+  {
+    using node_type  = typename Dd::node_type;
+    using label_type = typename Dd::label_type;
+    using frame_type = traverse_paths_frame<node_type>;
+
+    adiar_assert(!dd->is_terminal(), "Traversal of paths does not support terminal case");
+
+    const size_t levels      = dd->levels();
+    const size_t stack_bound = 2u * levels;
+
+    // Compute amount of memory available for the node access and the stack after having
+    // allocated the path itself.
+    const size_t path_memory = tpie::array<pair<label_type, bool>>::memory_usage(levels);
+    const size_t aux_available_memory =
+      path_memory < memory_available() ? memory_available() - path_memory : 0u;
+
+    const bool internal_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
+    const bool external_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::External;
+
+    const size_t stack_memory = stack<memory_mode::Internal, frame_type>::memory_usage(stack_bound);
+
+    const size_t array_memory  = traverse_paths_array<Dd>::memory_usage(dd) + stack_memory;
+    const size_t stream_memory = traverse_paths_stream<Dd>::memory_usage(dd) + stack_memory;
+
+    if (!external_only && (internal_only || array_memory <= aux_available_memory)) {
+      traverse_paths_array<Dd> nodes(dd);
+      stack<memory_mode::Internal, frame_type> path_stack(stack_bound);
+      __traverse_paths(nodes, path_stack, levels, callback);
+    } else if (!external_only && stream_memory <= aux_available_memory) {
+      traverse_paths_stream<Dd> nodes(dd);
+      stack<memory_mode::Internal, frame_type> path_stack(stack_bound);
+      __traverse_paths(nodes, path_stack, levels, callback);
+    } else {
+      traverse_paths_stream<Dd> nodes(dd);
+      stack<memory_mode::External, frame_type> path_stack;
+      __traverse_paths(nodes, path_stack, levels, callback);
+    }
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief Implementation of Visitor logic, traversing the lexicographically
   ///        smallest assignment.
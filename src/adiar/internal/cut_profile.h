@@ -0,0 +1,157 @@
+#ifndef ADIAR_INTERNAL_CUT_PROFILE_H
+#define ADIAR_INTERNAL_CUT_PROFILE_H
+
+#include <algorithm>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/cnl.h>
+#include <adiar/internal/cut.h>
+#include <adiar/internal/dd.h>
+#include <adiar/internal/data_types/level_info.h>
+#include <adiar/internal/io/levelized_ifstream.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Top-down reader of the (internal) cuts stored with each level of a decision diagram.
+  ///
+  /// \details The maximum i-level cuts in the file header are only the maxima over all levels. Yet,
+  ///          when combining multiple diagrams, the widest part of one may very well be aligned
+  ///          with a narrow part of the other. This provides an upper bound on the 1-level and
+  ///          2-level cut at each level, such that one can derive the bound level by level.
+  ///
+  ///          Between two levels of the diagram, the cut is bounded by the cut of either level.
+  ///          If the cut of a level is unknown, then the global maximum is used instead.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class cut_profile
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of a variable level.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using level_type = level_info::level_type;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Stream of all levels (top-down).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    level_info_ifstream<> _levels;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of internal arcs that may be missing from each level's cut.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    safe_size_t _slack;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Global maximum (internal) 1-level and 2-level cuts.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    cut::size_type _max_1level_cut;
+    cut::size_type _max_2level_cut;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Cut of the latest level passed by `seek` (or `cut::max` if unknown).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    cut::size_type _prev = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Cuts at the level of the latest `seek`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    cut::size_type _curr_1level_cut = 0u;
+    cut::size_type _curr_2level_cut = 0u;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of memory needed for the underlying stream.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage()
+    {
+      return level_info_ifstream<>::memory_usage();
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Attach to a (reduced) decision diagram.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    cut_profile(const dd& diagram)
+      : _levels(diagram)
+      , _slack(diagram->level_cut_slack)
+      , _max_1level_cut(diagram.max_1level_cut(cut::Internal))
+      , _max_2level_cut(diagram.max_2level_cut(cut::Internal))
+    {}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether there are more levels to seek to.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    has_next()
+    {
+      return _levels.can_pull();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The next level of the decision diagram.
+    ///
+    /// \pre `has_next() == true`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    level_type
+    next_level()
+    {
+      adiar_assert(has_next());
+      return _levels.peek().level();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Move to the given level.
+    ///
+    /// \details If the decision diagram has no nodes on the given level, then both cuts are the
+    ///          1-level cut in-between the levels around it.
+    ///
+    /// \pre     The given level is after the one of the previous call to `seek`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    seek(const level_type l)
+    {
+      while (has_next() && next_level() < l) { _prev = level_cut(_levels.pull()); }
+
+      cut::size_type c = 0u;
+      if (has_next() && next_level() == l) {
+        c = _prev = level_cut(_levels.pull());
+      } else if (has_next()) {
+        c = std::min(_prev, level_cut(_levels.peek()));
+      } // else: there are no internal arcs below the last level.
+
+      const cut::size_type c_with_slack = to_size(_slack + c);
+
+      _curr_1level_cut = std::min(c_with_slack, _max_1level_cut);
+      _curr_2level_cut = std::min(c_with_slack, _max_2level_cut);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Upper bound on the (internal) 1-level cut at the level of the latest `seek`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    cut::size_type
+    max_1level_cut() const
+    {
+      return _curr_1level_cut;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Upper bound on the (internal) 2-level cut at the level of the latest `seek`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    cut::size_type
+    max_2level_cut() const
+    {
+      return _curr_2level_cut;
+    }
+
+  private:
+    static cut::size_type
+    level_cut(const level_info& li)
+    {
+      return li.has_max_2level_cut() ? li.max_2level_cut() : cut::max;
+    }
+  };
+}
+
+#endif // ADIAR_INTERNAL_CUT_PROFILE_H
@@ -0,0 +1,68 @@
+#include "buffer_pool.h"
+
+#include <atomic>
+
+#include <tpie/memory.h>
+
+namespace adiar::internal
+{
+  statistics::buffer_pool_t stats_buffer_pool;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief State shared by all pools.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  struct buffer_pool_state
+  {
+    /// \brief Guard for the idle buffers of all pools and the functions to free them.
+    std::mutex mutex;
+
+    /// \brief Number of bytes in idle buffers (across all pools). This is only changed while
+    ///        holding the `mutex`, but may be read without it.
+    std::atomic<size_t> size{ 0u };
+
+    /// \brief Functions to free the idle buffers of each pool.
+    std::vector<void (*)()> clears;
+  };
+
+  buffer_pool_state _buffer_pool;
+
+  size_t
+  buffer_pool_capacity()
+  {
+    return memory_accounting ? tpie::get_memory_manager().limit() / 64u : 0u;
+  }
+
+  size_t
+  buffer_pool_size()
+  {
+    return _buffer_pool.size;
+  }
+
+  void
+  buffer_pool_clear()
+  {
+    const std::lock_guard<std::mutex> lock(_buffer_pool.mutex);
+    for (void (*clear)() : _buffer_pool.clears) { clear(); }
+    adiar_assert(_buffer_pool.size == 0u, "All idle buffers should have been freed");
+  }
+
+  std::mutex&
+  __buffer_pool_mutex()
+  {
+    return _buffer_pool.mutex;
+  }
+
+  void
+  __buffer_pool_account(ptrdiff_t bytes)
+  {
+    adiar_assert(0 <= bytes || static_cast<size_t>(-bytes) <= _buffer_pool.size,
+                 "Cannot free more idle bytes than there are");
+    _buffer_pool.size = static_cast<size_t>(static_cast<ptrdiff_t>(_buffer_pool.size) + bytes);
+  }
+
+  void
+  __buffer_pool_register(void (*clear)())
+  {
+    _buffer_pool.clears.push_back(clear);
+  }
+}
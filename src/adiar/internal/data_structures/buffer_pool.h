@@ -0,0 +1,198 @@
+#ifndef ADIAR_INTERNAL_DATA_STRUCTURES_BUFFER_POOL_H
+#define ADIAR_INTERNAL_DATA_STRUCTURES_BUFFER_POOL_H
+
+#include <mutex>
+#include <vector>
+
+#include <tpie/array.h>
+
+#include <adiar/statistics.h>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/memory.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Struct holding statistics on the pool of recycled internal memory buffers.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  extern statistics::buffer_pool_t stats_buffer_pool;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   The maximum number of bytes of idle buffers kept by all pools.
+  ///
+  /// \details Idle buffers are still accounted for in TPIE's memory manager, i.e. they are not part
+  ///          of `memory_available()`. Hence, only 1/64th of the memory limit is kept around.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  size_t
+  buffer_pool_capacity();
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The number of bytes of idle buffers currently kept by all pools.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  size_t
+  buffer_pool_size();
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Free all idle buffers kept by all pools.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  buffer_pool_clear();
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Mutex guarding the idle buffers of all pools and their bookkeeping.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::mutex&
+  __buffer_pool_mutex();
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Register the idle buffers of one pool.
+  ///
+  /// \param bytes Change in the number of idle bytes.
+  ///
+  /// \pre The caller holds `__buffer_pool_mutex()`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  __buffer_pool_account(ptrdiff_t bytes);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Register a function to free all idle buffers of one pool on `buffer_pool_clear()`.
+  ///
+  /// \pre The caller holds `__buffer_pool_mutex()`, which is also held when `clear` is called.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  __buffer_pool_register(void (*clear)());
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Pool of internal memory buffers for elements of type `T`.
+  ///
+  /// \details For many small operations, the (de)allocation of the `tpie::array` of each internal
+  ///          sorter, priority queue, and level buffer is a noticeable part of the running time.
+  ///          Hence, instead of freeing the buffer at the end of an operation, it is kept around
+  ///          to be handed out to the next data structure with a similar size.
+  ///
+  ///          A data structure is only given a buffer that is at most twice the size it asked for,
+  ///          such that large buffers are not wasted on small data structures. Since an idle buffer
+  ///          is already accounted for, using it does not take any of the `memory_available()`.
+  ///
+  ///          The pool is shared by all threads, such that `buffer_pool_clear()` frees every idle
+  ///          buffer before TPIE is deinitialized.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  class buffer_pool
+  {
+  public:
+    using array_type = tpie::array<T>;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Idle buffers (guarded by `__buffer_pool_mutex()`).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static inline std::vector<unique_ptr<array_type>> _idle;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether `__clear` has been registered (guarded by `__buffer_pool_mutex()`).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static inline bool _registered = false;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Free all idle buffers.
+    ///
+    /// \pre The caller holds `__buffer_pool_mutex()`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static void
+    __clear()
+    {
+      for (const unique_ptr<array_type>& a : _idle) {
+        __buffer_pool_account(-static_cast<ptrdiff_t>(array_type::memory_usage(a->size())));
+      }
+      _idle.clear();
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Give `a` (an empty array) a buffer of at least `n` elements.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static void
+    acquire(array_type& a, const size_t n)
+    {
+      adiar_assert(a.size() == 0u, "Array to be given a buffer should be empty");
+      if (n == 0u) { return; }
+
+      {
+        const std::lock_guard<std::mutex> lock(__buffer_pool_mutex());
+
+        size_t best = _idle.size();
+        for (size_t i = 0u; i < _idle.size(); ++i) {
+          const size_t i_size = _idle[i]->size();
+          if (i_size < n || 2u * n < i_size) { continue; }
+          if (best == _idle.size() || i_size < _idle[best]->size()) { best = i; }
+        }
+
+        if (best < _idle.size()) {
+#ifdef ADIAR_STATS
+          stats_buffer_pool.acquire_hit += 1u;
+#endif
+          a.swap(*_idle[best]);
+          __buffer_pool_account(-static_cast<ptrdiff_t>(array_type::memory_usage(a.size())));
+
+          std::swap(_idle[best], _idle.back());
+          _idle.pop_back();
+          return;
+        }
+
+#ifdef ADIAR_STATS
+        stats_buffer_pool.acquire_miss += 1u;
+#endif
+      }
+
+      // Allocate outside of the lock, such that other threads are not blocked by it.
+      a.resize(n);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Take over the buffer of `a` (if there is space for it).
+    ///
+    /// \details If the pool is full, then `a` keeps its buffer and frees it as usual.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static void
+    release(array_type& a)
+    {
+      if (a.size() == 0u) { return; }
+
+      const std::lock_guard<std::mutex> lock(__buffer_pool_mutex());
+
+      const size_t bytes = array_type::memory_usage(a.size());
+      if (!memory_accounting || buffer_pool_capacity() < buffer_pool_size() + bytes) {
+#ifdef ADIAR_STATS
+        stats_buffer_pool.release_discard += 1u;
+#endif
+        return;
+      }
+
+      if (!_registered) {
+        __buffer_pool_register(&__clear);
+        _registered = true;
+      }
+
+#ifdef ADIAR_STATS
+      stats_buffer_pool.release_recycle += 1u;
+#endif
+      _idle.push_back(adiar::make_unique<array_type>());
+      _idle.back()->swap(a);
+      __buffer_pool_account(static_cast<ptrdiff_t>(bytes));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Free all idle buffers of this pool.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static void
+    clear()
+    {
+      const std::lock_guard<std::mutex> lock(__buffer_pool_mutex());
+      __clear();
+    }
+  };
+}
+
+#endif // ADIAR_INTERNAL_DATA_STRUCTURES_BUFFER_POOL_H
@@ -52,6 +52,14 @@ namespace adiar::internal
       virtual value_type
       peek() = 0;
 
+      /// \brief Width of the next level (or `0` if unknown).
+      virtual size_t
+      peek_width() = 0;
+
+      /// \brief Number of arcs that cross the next level (or `0` if unknown).
+      virtual size_t
+      peek_cut() = 0;
+
       virtual value_type
       pull() = 0;
     };
@@ -90,6 +98,18 @@ namespace adiar::internal
         return this->_next.value();
       }
 
+      size_t
+      peek_width() override
+      {
+        return 0u;
+      }
+
+      size_t
+      peek_cut() override
+      {
+        return 0u;
+      }
+
       value_type
       pull() override
       {
@@ -127,6 +147,19 @@ namespace adiar::internal
         return this->_ifstream.peek().level();
       }
 
+      size_t
+      peek_width() override
+      {
+        return this->_ifstream.peek().width();
+      }
+
+      size_t
+      peek_cut() override
+      {
+        const level_info li = this->_ifstream.peek();
+        return li.has_max_2level_cut() ? li.max_2level_cut() : 0u;
+      }
+
       value_type
       pull() override
       {
@@ -255,6 +288,48 @@ namespace adiar::internal
       return min_level;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Width of the next level, i.e. the sum of its width within each input. Inputs that do
+    ///        not know the width of their levels contribute with `0`.
+    ///
+    /// \pre `can_pull() == true`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    peek_width()
+    {
+      const value_type level = peek();
+
+      size_t width = 0u;
+      for (istream_ptr& p : this->_istream_ptrs) {
+        if (p->can_pull() && level_of(p->peek()) == level) { width += p->peek_width(); }
+      }
+      return width;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Number of arcs that cross the next level, i.e. the sum of the cut stored with its
+    ///          `level_info` within each input.
+    ///
+    /// \details This is `0` if the cut of the level is unknown in any input that includes it.
+    ///
+    /// \pre `can_pull() == true`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    peek_cut()
+    {
+      const value_type level = peek();
+
+      size_t cut = 0u;
+      for (istream_ptr& p : this->_istream_ptrs) {
+        if (p->can_pull() && level_of(p->peek()) == level) {
+          const size_t p_cut = p->peek_cut();
+          if (p_cut == 0u) { return 0u; }
+          cut += p_cut;
+        }
+      }
+      return cut;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Obtain the next level and go to the next.
     ///
@@ -1,6 +1,7 @@
 #ifndef ADIAR_INTERNAL_DATA_STRUCTURES_LEVELIZED_PRIORITY_QUEUE_H
 #define ADIAR_INTERNAL_DATA_STRUCTURES_LEVELIZED_PRIORITY_QUEUE_H
 
+#include <algorithm>
 #include <limits>
 
 #include <adiar/statistics.h>
@@ -83,7 +84,8 @@ namespace adiar::internal
   /// \tparam LookAhead      The number of levels (ahead of the current) to explicitly handle with a
   ///                        sorting algorithm.
   ///
-  /// \tparam MemoryMode     Whether to use 'Internal' or 'External' memory data structures.
+  /// \tparam MemoryMode     Whether to use 'Internal', 'External', or 'Hybrid' memory data
+  ///                        structures.
   ///
   /// \tparam LevelInputs Number of files to obtain the levels from.
   ///
@@ -129,8 +131,11 @@ namespace adiar::internal
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Type of the overflow priority queue.
+    ///
+    /// \details Elements are only pushed to later levels than the current one, i.e. in a monotone
+    ///          order. Hence, a radix heap can be used, if possible.
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    using priority_queue_t = priority_queue<MemoryMode, value_type, value_comp_type>;
+    using priority_queue_t = monotone_priority_queue<MemoryMode, value_type, value_comp_type>;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Type of the level merger.
@@ -186,8 +191,8 @@ namespace adiar::internal
     static size_t
     memory_usage(size_t no_elements)
     {
-      return priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_usage(
-               no_elements)
+      return monotone_priority_queue<memory_mode::Internal, value_type, value_comp_type>::
+               memory_usage(no_elements)
         + buckets
         * sorter<memory_mode::Internal, value_type, value_comp_type>::memory_usage(no_elements)
         + const_memory_usage();
@@ -210,7 +215,7 @@ namespace adiar::internal
           memory_per_data_structure);
 
       const size_t priority_queue_fits =
-        priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_fits(
+        monotone_priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_fits(
           memory_per_data_structure);
 
       const size_t res = std::min(sorter_fits, priority_queue_fits);
@@ -218,6 +223,24 @@ namespace adiar::internal
       return res;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Minimum amount of memory needed to instantiate the levelized priority queue.
+    ///
+    /// \details In external memory, the overflow queue and the sorter of each bucket need some
+    ///          minimum amount of memory to work with. Since each bucket is only guaranteed half
+    ///          of an equal share, this is doubled for the buckets.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_minimum()
+    {
+      if constexpr (mem_mode == memory_mode::Internal) {
+        return memory_usage(1u);
+      } else {
+        return const_memory_usage() + priority_queue_t::memory_minimum()
+          + 2u * buckets * sorter_t::memory_minimum();
+      }
+    }
+
   private:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Number of elements in the levelized priority queue (excluding the one element
@@ -291,6 +314,28 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     unique_ptr<sorter_t> _buckets_sorter[buckets];
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Width of each bucket's level within the inputs (`0` if unknown).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _buckets_width[buckets];
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of arcs that cross each bucket's level within the inputs (`0` if unknown).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _buckets_cut[buckets];
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory of each bucket in addition to `bucket_base_memory()` (only used with the
+    ///        `Hybrid` memory mode).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _buckets_extra_memory[buckets] = {};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Bucket memory yet to be assigned to any bucket (only used with the `Hybrid` memory
+    ///        mode).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _free_extra_memory;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Index of the currently read-from bucket (if any).
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -323,6 +368,12 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     size_t _actual_max_size = 0u;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The maximum memory in use by all of Adiar (as accounted by TPIE), sampled at the
+    ///        start of each level.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _peak_memory = 0u;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Reference to struct to store non-global stats into.
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -349,20 +400,20 @@ namespace adiar::internal
         //   Divide memory in equal parts
 
         return memory_given / data_structures;
-      } else if constexpr (mem_mode == memory_mode::External) {
+      } else if constexpr (mem_mode == memory_mode::External || mem_mode == memory_mode::Hybrid) {
         // -----------------------------------------------------------------------------------------
-        // EXTERNAL MEMORY MODE:
-        //   Use 1/(4Buckets + 1)th of the memory and at least 8 MiB.
+        // EXTERNAL (AND HYBRID) MEMORY MODE:
+        //   Use 1/(4Buckets + 1)th of the memory and at least 8 MiB. A hybrid queue may end up
+        //   spilling into external memory, so it has to leave room for the external variants.
 
         // TODO: Unit test external memory variants?
-        const size_t eight_MiB      = 8 * 1024 * 1024;
         const size_t weighted_share = memory_given / (4 * buckets + 1);
 
-        return std::max(eight_MiB, weighted_share);
+        return std::max(priority_queue_t::memory_minimum(), weighted_share);
       } else {
         // -----------------------------------------------------------------------------------------
         static_assert(mem_mode == memory_mode::Internal && mem_mode == memory_mode::External,
-                      "Memory mode must be 'Internal' or 'EXTERNAL' at compile-time");
+                      "Memory mode must be 'Internal', 'External', or 'Hybrid' at compile-time");
       }
     }
 
@@ -396,6 +447,7 @@ namespace adiar::internal
                             - mem_overflow_queue(memory_given))
       , _memory_occupied_by_overflow(mem_overflow_queue(memory_given))
       , _level_merger(std::move(level_inputs))
+      , _free_extra_memory(_memory_for_buckets - buckets * bucket_base_memory())
       , _overflow_queue(mem_overflow_queue(memory_given), max_size)
 #ifdef ADIAR_STATS
       , _stats(stats)
@@ -413,6 +465,8 @@ namespace adiar::internal
       // Set up buckets until no levels are left or all buckets have been
       // instantiated. Notice, that _back_bucket_idx was initialised to -1.
       while (_back_bucket_idx + 1 < buckets && _level_merger.can_pull()) {
+        const size_t width                  = _level_merger.peek_width();
+        const size_t cut                    = _level_merger.peek_cut();
         const ptr_uint64::label_type level = _level_merger.pull();
 
         adiar_assert(_front_bucket_idx == out_of_buckets_idx, "Front bucket not moved");
@@ -420,8 +474,7 @@ namespace adiar::internal
         _back_bucket_idx++;
 
         _buckets_level[_back_bucket_idx] = level;
-        _buckets_sorter[_back_bucket_idx] =
-          sorter_t::make_unique(_memory_for_buckets, _max_size, buckets);
+        setup_bucket_sorter(_back_bucket_idx, width, cut, false);
       }
     }
 
@@ -441,6 +494,11 @@ namespace adiar::internal
 
       stats_levelized_priority_queue.sum_destructors += 1u;
       _stats.sum_destructors += 1u;
+
+      _peak_memory = std::max(_peak_memory, memory_used());
+      stats_levelized_priority_queue.peak_memory =
+        std::max(stats_levelized_priority_queue.peak_memory, _peak_memory);
+      _stats.peak_memory = std::max(_stats.peak_memory, _peak_memory);
 #endif
     }
 
@@ -556,6 +614,10 @@ namespace adiar::internal
       adiar_assert(!has_current_level() || empty_level(),
                    "Level is empty before moving on to the next");
 
+#ifdef ADIAR_STATS
+      _peak_memory = std::max(_peak_memory, memory_used());
+#endif
+
       adiar_assert(stop_level != no_label || !empty(),
                    "Either a stop level is given or we have some non-empty level to forward to");
 
@@ -848,11 +910,12 @@ namespace adiar::internal
 
         // Replace the current read-only bucket, if there is one
         if (_level_merger.can_pull() && has_front_bucket()) {
+          const size_t next_width                 = _level_merger.peek_width();
+          const size_t next_cut                   = _level_merger.peek_cut();
           const ptr_uint64::label_type next_level = _level_merger.pull();
 
           _buckets_level[_front_bucket_idx] = next_level;
-          sorter_t::reset_unique(
-            _buckets_sorter[_front_bucket_idx], _memory_for_buckets, _max_size, buckets);
+          setup_bucket_sorter(_front_bucket_idx, next_width, next_cut, true);
 
           _back_bucket_idx = _front_bucket_idx;
         }
@@ -893,6 +956,95 @@ namespace adiar::internal
         "Consistent bucket levels");
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory each bucket is guaranteed, i.e. half of an equal share.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    bucket_base_memory() const
+    {
+      return (_memory_for_buckets / buckets) / 2u;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Create (or reset) the sorter of a bucket for a level with the given width and cut.
+    ///
+    /// \details With the `Hybrid` memory mode, the memory is rebalanced between the buckets based
+    ///          on the width of their levels. Every bucket is guaranteed half of an equal share
+    ///          while the other half is lent out to the buckets of wide levels until they are
+    ///          reset. This way, buckets of wide levels are less likely to spill into external
+    ///          memory. Any other memory mode has its memory evenly distributed.
+    ///
+    ///          If the cut of the level is known, then it is used instead of the width to predict
+    ///          the number of elements. If these do not fit into the memory the bucket can be
+    ///          given, then it would spill anyway. Such a bucket is hence set up in external memory
+    ///          right away and is only given its guaranteed share.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline void
+    setup_bucket_sorter(const size_t idx, const size_t width, const size_t cut, const bool reset)
+    {
+      _buckets_width[idx] = width;
+      _buckets_cut[idx]   = cut;
+
+      if constexpr (mem_mode == memory_mode::Hybrid) {
+        const size_t equal_share = _memory_for_buckets / buckets;
+        const size_t base_memory = bucket_base_memory();
+
+        // Return the memory lent to this bucket's prior level
+        [[maybe_unused]] const size_t old_memory =
+          reset ? base_memory + _buckets_extra_memory[idx] : equal_share;
+        _free_extra_memory += _buckets_extra_memory[idx];
+
+        // Every arc into the level is the target of (roughly) one element. Without the cut, every
+        // node on the level is the target of at least one element, but usually of more.
+        const size_t demand = cut != 0u ? sorter_t::memory_usage(std::min(_max_size, cut))
+          : width != 0u                 ? sorter_t::memory_usage(std::min(_max_size, 2u * width))
+                                        : equal_share;
+
+        const size_t wanted_memory = demand - std::min(demand, base_memory);
+        const bool external        = cut != 0u && _free_extra_memory < wanted_memory;
+
+        const size_t extra_memory = external ? 0u : std::min(wanted_memory, _free_extra_memory);
+
+        _free_extra_memory -= extra_memory;
+        _buckets_extra_memory[idx] = extra_memory;
+
+        const size_t new_memory = base_memory + extra_memory;
+#ifdef ADIAR_STATS
+        if (new_memory != old_memory) {
+          stats_levelized_priority_queue.bucket_reallocations += 1u;
+          _stats.bucket_reallocations += 1u;
+        }
+        if (external) {
+          stats_levelized_priority_queue.external_buckets += 1u;
+          _stats.external_buckets += 1u;
+        }
+#endif
+        if (external) {
+          // An internal budget of 0 makes the sorter start out in external memory. Its share of
+          // the memory is then only the guaranteed one.
+          if (reset) {
+            sorter_t::reset_unique_with_budget(
+              _buckets_sorter[idx], 0u, base_memory, _max_size, 1u);
+          } else {
+            _buckets_sorter[idx] =
+              sorter_t::make_unique_with_budget(0u, base_memory, _max_size, 1u);
+          }
+        } else if (reset) {
+          sorter_t::reset_unique_with_budget(
+            _buckets_sorter[idx], new_memory, _memory_for_buckets, _max_size, buckets);
+        } else {
+          _buckets_sorter[idx] =
+            sorter_t::make_unique_with_budget(new_memory, _memory_for_buckets, _max_size, buckets);
+        }
+      } else {
+        if (reset) {
+          sorter_t::reset_unique(_buckets_sorter[idx], _memory_for_buckets, _max_size, buckets);
+        } else {
+          _buckets_sorter[idx] = sorter_t::make_unique(_memory_for_buckets, _max_size, buckets);
+        }
+      }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Relabel all buckets to be a level at or past the stop_level. If the current read-only
     ///        bucket is relabelled, then it is also reset to be pushable.
@@ -910,6 +1062,8 @@ namespace adiar::internal
 
       // Create a list of the new levels
       ptr_uint64::label_type new_levels[buckets];
+      size_t new_widths[buckets];
+      size_t new_cuts[buckets];
       _back_bucket_idx = out_of_buckets_idx;
 
       // Copy over still relevant levels from current buckets
@@ -921,7 +1075,9 @@ namespace adiar::internal
         if (level_cmp_le<LevelComp>(front_bucket_level(), stop_level, _level_comparator)) {
           _current_level = front_bucket_level();
         } else { // level_cmp_lt<LevelComp>(stop_level, front_bucket_level(), _level_comparator)
-          new_levels[++_back_bucket_idx] = front_bucket_level();
+          new_widths[_back_bucket_idx + 1] = _buckets_width[_front_bucket_idx];
+          new_cuts[_back_bucket_idx + 1]   = _buckets_cut[_front_bucket_idx];
+          new_levels[++_back_bucket_idx]   = front_bucket_level();
         }
       } while (_front_bucket_idx != old_back_bucket_idx);
 
@@ -934,7 +1090,9 @@ namespace adiar::internal
       }
 
       while (_back_bucket_idx + 1 < buckets && _level_merger.can_pull()) {
-        new_levels[++_back_bucket_idx] = _level_merger.pull();
+        new_widths[_back_bucket_idx + 1] = _level_merger.peek_width();
+        new_cuts[_back_bucket_idx + 1]   = _level_merger.peek_cut();
+        new_levels[++_back_bucket_idx]   = _level_merger.pull();
       }
 
       adiar_assert(_back_bucket_idx == out_of_buckets_idx || _back_bucket_idx < buckets,
@@ -944,12 +1102,15 @@ namespace adiar::internal
       if (_back_bucket_idx != out_of_buckets_idx) {
         for (size_t idx = 0; idx <= _back_bucket_idx; idx++) {
           _buckets_level[idx] = new_levels[idx];
-        }
 
-        // Reset the prior read-only bucket, if relevant
-        if (old_front_bucket_idx <= _back_bucket_idx) {
-          sorter_t::reset_unique(
-            _buckets_sorter[old_front_bucket_idx], _memory_for_buckets, _max_size, buckets);
+          // Since all buckets are empty, the memory of each (pushable) bucket can be rebalanced
+          // for its new level. Otherwise, only reset the prior read-only bucket, if relevant.
+          if (mem_mode == memory_mode::Hybrid || idx == old_front_bucket_idx) {
+            setup_bucket_sorter(idx, new_widths[idx], new_cuts[idx], true);
+          } else {
+            _buckets_width[idx] = new_widths[idx];
+            _buckets_cut[idx]   = new_cuts[idx];
+          }
         }
 
         // We can clean up all the dead buckets with a '.reset()' on the
@@ -1003,7 +1164,7 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Type of the (overflow) priority queue.
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    using priority_queue_t = priority_queue<mem_mode, value_type, value_comp_type>;
+    using priority_queue_t = monotone_priority_queue<mem_mode, value_type, value_comp_type>;
 
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1025,15 +1186,28 @@ namespace adiar::internal
     static size_t
     memory_usage(size_t no_elements)
     {
-      return priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_usage(
-        no_elements);
+      return monotone_priority_queue<memory_mode::Internal, value_type, value_comp_type>::
+        memory_usage(no_elements);
     }
 
     static size_t
     memory_fits(size_t memory_bytes)
     {
-      return priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_fits(
-        memory_bytes);
+      return monotone_priority_queue<memory_mode::Internal, value_type, value_comp_type>::
+        memory_fits(memory_bytes);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Minimum amount of memory needed to instantiate the levelized priority queue.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_minimum()
+    {
+      if constexpr (mem_mode == memory_mode::Internal) {
+        return memory_usage(1u);
+      } else {
+        return priority_queue_t::memory_minimum();
+      }
     }
 
   private:
@@ -1074,6 +1248,12 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     size_t _actual_max_size = 0u;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The maximum memory in use by all of Adiar (as accounted by TPIE), sampled at the
+    ///        start of each level.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _peak_memory = 0u;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Reference to struct to store non-global stats into.
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1114,6 +1294,11 @@ namespace adiar::internal
 
       stats_levelized_priority_queue.sum_destructors += 1u;
       _stats.sum_destructors += 1u;
+
+      _peak_memory = std::max(_peak_memory, memory_used());
+      stats_levelized_priority_queue.peak_memory =
+        std::max(stats_levelized_priority_queue.peak_memory, _peak_memory);
+      _stats.peak_memory = std::max(_stats.peak_memory, _peak_memory);
 #endif
     }
 
@@ -1204,6 +1389,10 @@ namespace adiar::internal
       adiar_assert(!has_current_level() || empty_level(),
                    "Level is empty before moving on to the next");
 
+#ifdef ADIAR_STATS
+      _peak_memory = std::max(_peak_memory, memory_used());
+#endif
+
       const bool has_stop_level = stop_level != no_label;
 
       adiar_assert(has_stop_level || !empty(),
@@ -1,12 +1,21 @@
 #ifndef ADIAR_INTERNAL_DATA_STRUCTURES_PRIORITY_QUEUE_H
 #define ADIAR_INTERNAL_DATA_STRUCTURES_PRIORITY_QUEUE_H
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <functional>
+#include <type_traits>
+#include <utility>
 
+#include <tpie/array.h>
+#include <tpie/file_stream.h>
 #include <tpie/priority_queue.h>
 #include <tpie/tpie.h>
 
 #include <adiar/internal/assert.h>
+#include <adiar/internal/data_structures/buffer_pool.h>
+#include <adiar/internal/data_structures/radix_sort.h>
 #include <adiar/internal/memory.h>
 
 namespace adiar::internal
@@ -107,6 +116,15 @@ namespace adiar::internal
 
     using value_type = T;
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Minimum amount of memory to give TPIE's priority queue.
+    ////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t
+    memory_minimum()
+    {
+      return 8 * 1024 * 1024;
+    }
+
   private:
     using pq_type = tpie::priority_queue<value_type, Comp>;
     pq_type pq;
@@ -159,6 +177,478 @@ namespace adiar::internal
   //////////////////////////////////////////////////////////////////////////////
   template <typename T, typename Comp = std::less<T>>
   using external_priority_queue = priority_queue<memory_mode::External, T, Comp>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Priority queue that starts out as TPIE's internal binary heap and
+  ///        only spills into TPIE's external priority queue, if it is given
+  ///        more elements than fit into its memory.
+  ///
+  /// \details When spilling, the heap is first moved to a temporary file, such
+  ///          that it can be released before the external priority queue claims
+  ///          its memory.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp>
+  class priority_queue<memory_mode::Hybrid, T, Comp>
+  {
+  public:
+    static constexpr size_t data_structures = 1u;
+
+    using value_type = T;
+
+  private:
+    using internal_pq_type = priority_queue<memory_mode::Internal, T, Comp>;
+    using external_pq_type = priority_queue<memory_mode::External, T, Comp>;
+
+    unique_ptr<internal_pq_type> _internal_pq;
+    unique_ptr<external_pq_type> _external_pq;
+
+    const size_t _memory_bytes;
+    const size_t _max_size;
+    const size_t _internal_capacity;
+
+  public:
+    static size_t
+    memory_usage(size_t no_elements)
+    {
+      return internal_pq_type::memory_usage(no_elements);
+    }
+
+    static size_t
+    memory_fits(size_t memory_bytes)
+    {
+      return internal_pq_type::memory_fits(memory_bytes);
+    }
+
+    static constexpr size_t
+    memory_minimum()
+    {
+      return external_pq_type::memory_minimum();
+    }
+
+  public:
+    priority_queue(size_t memory_bytes, size_t max_size)
+      : _internal_pq(nullptr)
+      , _external_pq(nullptr)
+      , _memory_bytes(memory_bytes)
+      , _max_size(max_size)
+      , _internal_capacity(std::min(max_size, internal_pq_type::memory_fits(memory_bytes)))
+    {
+      _internal_pq = adiar::make_unique<internal_pq_type>(memory_bytes, _internal_capacity);
+    }
+
+  private:
+    void
+    spill()
+    {
+      adiar_assert(!spilled(), "Can only spill once");
+
+      tpie::file_stream<value_type> spill_file;
+      spill_file.open();
+
+      while (!_internal_pq->empty()) {
+        spill_file.write(_internal_pq->top());
+        _internal_pq->pop();
+      }
+      _internal_pq = nullptr;
+
+      _external_pq = adiar::make_unique<external_pq_type>(_memory_bytes, _max_size);
+
+      spill_file.seek(0);
+      while (spill_file.can_read()) { _external_pq->push(spill_file.read()); }
+    }
+
+  public:
+    /// \brief Whether the content has been moved to external memory.
+    bool
+    spilled() const
+    {
+      return static_cast<bool>(_external_pq);
+    }
+
+    value_type
+    top()
+    {
+      return spilled() ? _external_pq->top() : _internal_pq->top();
+    }
+
+    void
+    pop()
+    {
+      if (spilled()) {
+        _external_pq->pop();
+      } else {
+        _internal_pq->pop();
+      }
+    }
+
+    void
+    push(const value_type& v)
+    {
+      if (!spilled() && _internal_pq->size() == _internal_capacity) { spill(); }
+
+      if (spilled()) {
+        _external_pq->push(v);
+      } else {
+        _internal_pq->push(v);
+      }
+    }
+
+    size_t
+    size() const
+    {
+      return spilled() ? _external_pq->size() : _internal_pq->size();
+    }
+
+    bool
+    empty() const
+    {
+      return size() == 0;
+    }
+
+    bool
+    has_top() const
+    {
+      return !this->empty();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Type alias for sorter for partial type application of the
+  ///        'hybrid' memory type.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp = std::less<T>>
+  using hybrid_priority_queue = priority_queue<memory_mode::Hybrid, T, Comp>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Index of the most significant set bit of a (non-zero) word.
+  //////////////////////////////////////////////////////////////////////////////
+  inline size_t
+  __radix_heap_msb(uint64_t x)
+  {
+    adiar_assert(x != 0u, "Some bit must be set");
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - static_cast<size_t>(__builtin_clzll(x));
+#else
+    size_t res = 0u;
+    while (x >>= 1u) { res++; }
+    return res;
+#endif
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Monotone priority queue (radix heap) in internal memory for
+  ///        comparators that are a plain key extraction (see `has_radix_key`).
+  ///
+  /// \details A radix heap places each element in the bucket of the most
+  ///          significant bit in which its key differs from the last popped
+  ///          one. Hence, elements are only moved towards the front, i.e. each
+  ///          element is moved at most once per bit of the key, rather than
+  ///          sifted up and down a binary heap on every push and pop.
+  ///
+  ///          To stay within the same memory bounds as a binary heap, the
+  ///          buckets are linked lists of fixed-size chunks that are all
+  ///          allocated up-front.
+  ///
+  /// \pre Elements are never pushed with a key smaller than the last popped
+  ///      one. This is the case for the levelized priority queue, since
+  ///      elements are only ever pushed to later levels than the current one.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp>
+  class radix_heap
+  {
+    static_assert(has_radix_key_v<Comp, T>, "Comparator must be a plain key extraction");
+
+  public:
+    static constexpr size_t data_structures = 1u;
+
+    using value_type = T;
+
+  private:
+    static constexpr size_t words = radix_words_of<Comp, T>::value;
+
+    using key_type = std::array<uint64_t, words>;
+
+    /// \brief Number of buckets: one for keys equal to the last popped one
+    ///        and one per bit of the key.
+    static constexpr size_t buckets = 1u + 64u * words;
+
+    /// \brief Number of elements in each chunk.
+    static constexpr size_t chunk_size = 32u;
+
+    static constexpr size_t no_chunk = static_cast<size_t>(-1);
+
+    struct chunk
+    {
+      value_type elems[chunk_size];
+      size_t size;
+      size_t next;
+    };
+
+    using array_type = tpie::array<chunk>;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Number of chunks needed for the given number of elements, i.e.
+    ///        all full chunks plus one partially filled chunk per bucket.
+    //////////////////////////////////////////////////////////////////////////
+    static size_t
+    chunks_for(size_t no_elements)
+    {
+      return (no_elements + chunk_size - 1u) / chunk_size + buckets + 1u;
+    }
+
+  public:
+    static size_t
+    memory_usage(size_t no_elements)
+    {
+      return array_type::memory_usage(chunks_for(no_elements));
+    }
+
+    static size_t
+    memory_fits(size_t memory_bytes)
+    {
+      const size_t chunks = array_type::memory_fits(memory_bytes);
+      if (chunks < chunks_for(0u)) { return 0u; }
+
+      const size_t ret = (chunks - chunks_for(0u)) * chunk_size;
+
+      adiar_assert(memory_usage(ret) <= memory_bytes, "memory_fits and memory_usage should agree.");
+      return ret;
+    }
+
+  private:
+    array_type _chunks;
+    size_t _free_chunks = no_chunk;
+
+    size_t _buckets[buckets];
+
+    key_type _last = {};
+
+    size_t _size = 0u;
+
+    /// \brief Whether the position of the minimum of the first non-empty bucket
+    ///        (if it is not bucket 0) is known.
+    mutable bool _has_min = false;
+    mutable size_t _min_chunk;
+    mutable size_t _min_idx;
+
+  private:
+    static key_type
+    key_of(const value_type& v)
+    {
+      key_type k;
+      for (size_t w = 0u; w < words; ++w) { k[w] = Comp::radix_key(v, w); }
+      return k;
+    }
+
+    size_t
+    bucket_of(const key_type& k) const
+    {
+      for (size_t w = 0u; w < words; ++w) {
+        const uint64_t diff = k[w] ^ _last[w];
+        if (diff != 0u) { return 1u + (words - 1u - w) * 64u + __radix_heap_msb(diff); }
+      }
+      return 0u;
+    }
+
+    void
+    bucket_push(const size_t b, const value_type& v)
+    {
+      size_t head = _buckets[b];
+      if (head == no_chunk || _chunks[head].size == chunk_size) {
+        adiar_assert(_free_chunks != no_chunk, "Preallocated chunks suffice");
+
+        const size_t c = _free_chunks;
+        _free_chunks   = _chunks[c].next;
+
+        _chunks[c].size = 0u;
+        _chunks[c].next = head;
+
+        _buckets[b] = head = c;
+      }
+      _chunks[head].elems[_chunks[head].size++] = v;
+    }
+
+    void
+    free_chunk(const size_t c)
+    {
+      _chunks[c].next = _free_chunks;
+      _free_chunks    = c;
+    }
+
+    size_t
+    first_nonempty_bucket() const
+    {
+      size_t b = 0u;
+      while (_buckets[b] == no_chunk) { b++; }
+      return b;
+    }
+
+    /// \brief Minimum of the first non-empty bucket `b`. Unless `b` is 0, its
+    ///        position is remembered until the next redistribution, such
+    ///        that `pop()` removes this very element.
+    const value_type&
+    bucket_min(const size_t b) const
+    {
+      // In bucket 0, all elements have the same key. The last one is popped.
+      if (b == 0u) {
+        const size_t head = _buckets[0];
+        return _chunks[head].elems[_chunks[head].size - 1u];
+      }
+
+      if (!_has_min) {
+        Comp comp;
+        _min_chunk = _buckets[b];
+        _min_idx   = 0u;
+        for (size_t c = _buckets[b]; c != no_chunk; c = _chunks[c].next) {
+          for (size_t i = 0u; i < _chunks[c].size; ++i) {
+            if (comp(_chunks[c].elems[i], _chunks[_min_chunk].elems[_min_idx])) {
+              _min_chunk = c;
+              _min_idx   = i;
+            }
+          }
+        }
+        _has_min = true;
+      }
+      return _chunks[_min_chunk].elems[_min_idx];
+    }
+
+    /// \brief Move the content of the first non-empty bucket into bucket 0
+    ///        (and other buckets in-between). Its minimum is moved last, i.e.
+    ///        it is the one to be popped from bucket 0.
+    void
+    redistribute()
+    {
+      const size_t b = first_nonempty_bucket();
+      if (b == 0u) { return; }
+
+      const value_type min   = bucket_min(b);
+      const size_t min_chunk = _min_chunk;
+      const size_t min_idx   = _min_idx;
+
+      _last    = key_of(min);
+      _has_min = false;
+
+      size_t c    = _buckets[b];
+      _buckets[b] = no_chunk;
+
+      while (c != no_chunk) {
+        const size_t next = _chunks[c].next;
+        for (size_t i = 0u; i < _chunks[c].size; ++i) {
+          if (c == min_chunk && i == min_idx) { continue; }
+
+          const size_t new_b = bucket_of(key_of(_chunks[c].elems[i]));
+          adiar_assert(new_b < b, "Elements are moved towards the front");
+          bucket_push(new_b, _chunks[c].elems[i]);
+        }
+        free_chunk(c);
+        c = next;
+      }
+      bucket_push(0u, min);
+    }
+
+  public:
+    radix_heap([[maybe_unused]] size_t memory_bytes, size_t max_size)
+    {
+      adiar_assert(max_size <= memory_fits(memory_bytes),
+                   "Must be instantiated with enough memory.");
+
+      buffer_pool<chunk>::acquire(_chunks, chunks_for(max_size));
+      for (size_t c = _chunks.size(); 0u < c; --c) { free_chunk(c - 1u); }
+      for (size_t b = 0u; b < buckets; ++b) { _buckets[b] = no_chunk; }
+    }
+
+    ~radix_heap()
+    {
+      buffer_pool<chunk>::release(_chunks);
+    }
+
+    value_type
+    top() const
+    {
+      adiar_assert(!empty(), "Can only obtain top of non-empty priority queue");
+
+      return bucket_min(first_nonempty_bucket());
+    }
+
+    void
+    pop()
+    {
+      adiar_assert(!empty(), "Can only pop from non-empty priority queue");
+
+      redistribute();
+
+      const size_t head = _buckets[0];
+      if (--_chunks[head].size == 0u) {
+        _buckets[0] = _chunks[head].next;
+        free_chunk(head);
+      }
+      _size--;
+    }
+
+    void
+    push(const value_type& v)
+    {
+      const key_type k = key_of(v);
+      adiar_assert(_last <= k, "Radix heap requires monotone pushes");
+
+      const size_t b          = bucket_of(k);
+      const bool had_elements = _buckets[b] != no_chunk;
+      bucket_push(b, v);
+      _size++;
+
+      // Keep the current top element of bucket 0 at its end.
+      if (b == 0u && had_elements) {
+        const size_t head = _buckets[0];
+        const size_t prev = _chunks[head].size == 1u ? _chunks[head].next : head;
+        std::swap(_chunks[head].elems[_chunks[head].size - 1u],
+                  _chunks[prev].elems[_chunks[prev].size - (prev == head ? 2u : 1u)]);
+      }
+
+      // The minimum is only remembered while bucket 0 is empty. Once it is not, the top element
+      // is taken from bucket 0 instead (which may be freed by the next `pop()`).
+      if (b == 0u) {
+        _has_min = false;
+        return;
+      }
+
+      // Elements are only appended, i.e. the remembered minimum stays in place.
+      if (_has_min && Comp()(v, _chunks[_min_chunk].elems[_min_idx])) {
+        _min_chunk = _buckets[b];
+        _min_idx   = _chunks[_buckets[b]].size - 1u;
+      }
+    }
+
+    size_t
+    size() const
+    {
+      return _size;
+    }
+
+    bool
+    empty() const
+    {
+      return _size == 0u;
+    }
+
+    bool
+    has_top() const
+    {
+      return !this->empty();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Priority queue for elements that are pushed in a monotone order,
+  ///        e.g. the overflow queue of the levelized priority queue.
+  ///
+  /// \details In internal memory, this is a radix heap if `Comp` is a plain key
+  ///          extraction. Otherwise, it is the same as `priority_queue`.
+  //////////////////////////////////////////////////////////////////////////////
+  template <memory_mode mem_mode, typename T, typename Comp = std::less<T>>
+  using monotone_priority_queue =
+    std::conditional_t<mem_mode == memory_mode::Internal && has_radix_key_v<Comp, T>,
+                       radix_heap<T, Comp>,
+                       priority_queue<mem_mode, T, Comp>>;
 }
 
 #endif // ADIAR_INTERNAL_DATA_STRUCTURES_PRIORITY_QUEUE_H
@@ -0,0 +1,165 @@
+#ifndef ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_SORT_H
+#define ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_SORT_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of words of the key, if the comparator `Comp` on `T` is a plain key extraction.
+  ///
+  /// \details A comparator is a plain key extraction if it provides
+  ///
+  ///          - `static constexpr size_t radix_words`: the (positive) number of 64-bit words of
+  ///            the key (the value 0 marks that it is not a plain key extraction).
+  ///
+  ///          - `static uint64_t radix_key(const T& t, size_t w)`: the `w`th most significant
+  ///            word of the key of `t`.
+  ///
+  ///          such that `Comp()(a, b)` if and only if the key of `a` is lexicographically smaller
+  ///          than the key of `b`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Comp, typename T, typename = void>
+  struct radix_words_of : std::integral_constant<size_t, 0u>
+  {};
+
+  template <typename Comp, typename T>
+  struct radix_words_of<
+    Comp,
+    T,
+    std::void_t<decltype(Comp::radix_words),
+                decltype(Comp::radix_key(std::declval<const T&>(), std::declval<size_t>()))>>
+    : std::integral_constant<size_t, Comp::radix_words>
+  {};
+
+  template <typename Comp, typename T>
+  inline constexpr bool has_radix_key_v = 0u < radix_words_of<Comp, T>::value;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of elements below which a comparison-based sort is used instead.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  constexpr size_t radix_sort_threshold = 1024u;
+
+  /// \brief Number of elements below which a bucket is sorted with a comparison-based sort.
+  constexpr size_t __radix_sort_bucket_threshold = 64u;
+
+  /// \brief Number of bits of a single digit.
+  constexpr size_t __radix_sort_digit_bits = 8u;
+
+  /// \brief Number of buckets per digit.
+  constexpr size_t __radix_sort_buckets = size_t(1u) << __radix_sort_digit_bits;
+
+  /// \brief Number of digits per word.
+  constexpr size_t __radix_sort_digits_per_word = 64u / __radix_sort_digit_bits;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief In-place MSD radix sort (American flag sort) of [begin, end) starting at `digit`.
+  ///
+  /// \param varying For each word of the key, the bits that differ between any two elements.
+  ///                Digits without any varying bits are skipped.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Comp, typename RandomIt>
+  void
+  __radix_sort(RandomIt begin,
+               RandomIt end,
+               const std::array<uint64_t, Comp::radix_words>& varying,
+               size_t digit,
+               Comp& comp)
+  {
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+    constexpr size_t digits = Comp::radix_words * __radix_sort_digits_per_word;
+
+    const auto shift_of = [](const size_t d) -> size_t {
+      return 64u - __radix_sort_digit_bits * (1u + d % __radix_sort_digits_per_word);
+    };
+
+    // Skip the digits that are the same for all elements, e.g. the label of a single level.
+    while (digit < digits
+           && ((varying[digit / __radix_sort_digits_per_word] >> shift_of(digit))
+               & (__radix_sort_buckets - 1u))
+                == 0u) {
+      ++digit;
+    }
+    if (digit == digits) { return; }
+
+    if (static_cast<size_t>(end - begin) < __radix_sort_bucket_threshold) {
+      std::sort(begin, end, comp);
+      return;
+    }
+
+    const size_t word  = digit / __radix_sort_digits_per_word;
+    const size_t shift = shift_of(digit);
+
+    const auto bucket_of = [word, shift](const value_type& v) -> size_t {
+      return (Comp::radix_key(v, word) >> shift) & (__radix_sort_buckets - 1u);
+    };
+
+    // Compute the start and end of each bucket
+    std::array<size_t, __radix_sort_buckets> head = {};
+    for (RandomIt it = begin; it != end; ++it) { head[bucket_of(*it)] += 1u; }
+
+    std::array<size_t, __radix_sort_buckets> tail;
+    for (size_t b = 0u, sum = 0u; b < __radix_sort_buckets; ++b) {
+      const size_t count = head[b];
+      head[b]            = sum;
+      sum += count;
+      tail[b] = sum;
+    }
+    const std::array<size_t, __radix_sort_buckets> bucket_begin = head;
+
+    // Permute each element into its bucket by following its cycle.
+    for (size_t b = 0u; b < __radix_sort_buckets; ++b) {
+      while (head[b] < tail[b]) {
+        value_type v = begin[head[b]];
+        size_t v_b   = bucket_of(v);
+
+        while (v_b != b) {
+          std::swap(v, begin[head[v_b]++]);
+          v_b = bucket_of(v);
+        }
+        begin[head[b]++] = v;
+      }
+    }
+
+    // Recurse on the next digit within each bucket
+    for (size_t b = 0u; b < __radix_sort_buckets; ++b) {
+      if (tail[b] - bucket_begin[b] > 1u) {
+        __radix_sort(begin + bucket_begin[b], begin + tail[b], varying, digit + 1u, comp);
+      }
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Sort [begin, end) with an in-place MSD radix sort on the key provided by `Comp`.
+  ///
+  /// \details Since this sort is in-place, it has the same memory footprint as a comparison-based
+  ///          sort. Digits that are constant for all elements (e.g. the label of all pointers
+  ///          within a single level or the unused bits of the packed `ptr_uint64`) are skipped.
+  ///
+  /// \pre `has_radix_key_v<Comp, T>`
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Comp, typename RandomIt>
+  void
+  radix_sort(RandomIt begin, RandomIt end, Comp comp = Comp())
+  {
+    if (end - begin < 2) { return; }
+
+    std::array<uint64_t, Comp::radix_words> varying = {};
+    for (RandomIt it = begin + 1; it != end; ++it) {
+      for (size_t w = 0u; w < Comp::radix_words; ++w) {
+        varying[w] |= Comp::radix_key(*it, w) ^ Comp::radix_key(*begin, w);
+      }
+    }
+
+    __radix_sort(begin, end, varying, 0u, comp);
+  }
+}
+
+#endif // ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_SORT_H
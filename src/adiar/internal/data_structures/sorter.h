@@ -7,10 +7,13 @@
 #include <memory>
 #include <string>
 
+#include <tpie/file_stream.h>
 #include <tpie/sort.h>
 #include <tpie/tpie.h>
 
 #include <adiar/internal/assert.h>
+#include <adiar/internal/data_structures/buffer_pool.h>
+#include <adiar/internal/data_structures/radix_sort.h>
 #include <adiar/internal/memory.h>
 
 namespace adiar::internal
@@ -20,6 +23,9 @@ namespace adiar::internal
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Wrapper for TPIE's internal vector with TPIE's parallel quick-sort.
+  ///
+  /// \details If `Comp` is a plain key extraction (see `has_radix_key`), then large inputs are
+  ///          instead sorted with an in-place radix sort.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   template <typename T, typename Comp>
   class sorter<memory_mode::Internal, T, Comp>
@@ -31,6 +37,9 @@ namespace adiar::internal
     using array_type = tpie::array<T>;
     array_type _array;
 
+    /// \brief Number of elements that may be pushed (the buffer from the pool may be larger).
+    size_t _capacity;
+
     Comp _pred;
     bool _sorted = false;
 
@@ -83,19 +92,36 @@ namespace adiar::internal
            size_t no_elements,
            [[maybe_unused]] size_t no_sorters = 1,
            Comp comp                          = Comp())
-      : _array(no_elements)
+      : _capacity(no_elements)
       , _pred(comp)
     {
       adiar_assert(no_elements <= memory_fits(memory_bytes / no_sorters),
                    "Must be instantiated with enough memory.");
+
+      buffer_pool<T>::acquire(this->_array, no_elements);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ~sorter()
+    {
+      buffer_pool<T>::release(this->_array);
     }
 
   public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements that may be pushed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    capacity() const
+    {
+      return this->_capacity;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     bool
     can_push() const
     {
-      return !this->_sorted && this->_array.size() > this->_size;
+      return !this->_sorted && this->_capacity > this->_size;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -111,7 +137,18 @@ namespace adiar::internal
     sort()
     {
       adiar_assert(this->_sorted == false);
-      tpie::parallel_sort(this->_array.begin(), this->_array.begin() + this->_size, this->_pred);
+      const auto begin = this->_array.begin();
+      const auto end   = begin + this->_size;
+
+      if constexpr (has_radix_key_v<Comp, value_type>) {
+        if (radix_sort_threshold <= this->_size) {
+          radix_sort(begin, end, this->_pred);
+        } else {
+          tpie::parallel_sort(begin, end, this->_pred);
+        }
+      } else {
+        tpie::parallel_sort(begin, end, this->_pred);
+      }
       this->_sorted = true;
       adiar_assert(this->_front_idx == 0);
     }
@@ -190,9 +227,21 @@ namespace adiar::internal
 
     size_t _pulls = 0u;
 
+    // Quickfix: Issue https://github.com/thomasmoelhave/tpie/issues/250
+    static constexpr size_t minimum_phase1 = sizeof(value_type) * 128 * 1024 + 5 * 1024 * 1024;
+
   public:
     static constexpr size_t data_structures = 1u;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Minimum amount of memory a single sorter is given.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t
+    memory_minimum()
+    {
+      return 2 * minimum_phase1;
+    }
+
     static unique_ptr<sorter<memory_mode::External, value_type, Comp>>
     make_unique(size_t memory_bytes, size_t no_elements, size_t no_sorters = 1, Comp comp = Comp())
     {
@@ -217,9 +266,6 @@ namespace adiar::internal
            Comp comp                = Comp())
       : _sorter(comp)
     {
-      // Quickfix: Issue https://github.com/thomasmoelhave/tpie/issues/250
-      constexpr size_t minimum_phase1 = sizeof(value_type) * 128 * 1024 + 5 * 1024 * 1024;
-
       // ===========================================================================================
       // Case 0: No sorters - why are we then instantiating one?
       adiar_assert(number_of_sorters > 0, "Number of sorters should be positive");
@@ -234,7 +280,7 @@ namespace adiar::internal
       // Case 1: A single sorter.
       if (number_of_sorters == 1u) {
         const size_t sorter_memory =
-          std::min(std::max(no_elements_memory, 2 * minimum_phase1), memory_bytes);
+          std::min(std::max(no_elements_memory, memory_minimum()), memory_bytes);
 
         adiar_assert(sorter_memory <= memory_bytes,
                      "Memory of a single sorter does not exceed given amount.");
@@ -379,6 +425,302 @@ namespace adiar::internal
   //////////////////////////////////////////////////////////////////////////////////////////////////
   template <typename T, typename Comp = std::less<T>>
   using external_sorter = sorter<memory_mode::External, T, Comp>;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Sorter that starts out in internal memory and only spills into an external memory
+  ///        sorter, if it is given more elements than fit into its share of the memory.
+  ///
+  /// \details Unlike picking the memory mode up-front based on an (over-approximated) bound on the
+  ///          number of elements, this only pays for the external memory sorter if it is actually
+  ///          needed. When spilling, the buffered elements are sorted and written to a temporary
+  ///          file, such that the internal buffer is released before the external sorter claims its
+  ///          memory. This sorted run is not pushed into the external sorter, but merged with its
+  ///          output when pulling.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp>
+  class sorter<memory_mode::Hybrid, T, Comp>
+  {
+  public:
+    using value_type = T;
+
+  private:
+    using internal_sorter_type = sorter<memory_mode::Internal, value_type, Comp>;
+    using external_sorter_type = sorter<memory_mode::External, value_type, Comp>;
+
+    using spill_stream_type = tpie::file_stream<value_type>;
+
+    unique_ptr<internal_sorter_type> _internal_sorter;
+    unique_ptr<external_sorter_type> _external_sorter;
+
+    /// \brief Sorted run of the elements buffered in internal memory before spilling.
+    spill_stream_type _spill_stream;
+
+    /// \brief Number of elements pulled from the sorted run.
+    size_t _spill_pulls = 0u;
+
+    /// \brief This sorter's share of the memory, i.e. the memory of its internal buffer.
+    size_t _internal_memory;
+    size_t _no_elements;
+    Comp _comp;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage(size_t no_elements)
+    {
+      return internal_sorter_type::memory_usage(no_elements);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_fits(size_t memory_bytes)
+    {
+      return internal_sorter_type::memory_fits(memory_bytes);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Minimum amount of memory, i.e. the one of the sorter it may spill into together with
+    ///        the stream of its sorted run.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_minimum()
+    {
+      return external_sorter_type::memory_minimum() + spill_stream_type::memory_usage();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t data_structures = 1u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static unique_ptr<sorter<memory_mode::Hybrid, value_type, Comp>>
+    make_unique(size_t memory_bytes, size_t no_elements, size_t no_sorters = 1, Comp comp = Comp())
+    {
+      return adiar::make_unique<sorter<memory_mode::Hybrid, value_type, Comp>>(
+        memory_bytes, no_elements, no_sorters, comp);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static void
+    reset_unique(unique_ptr<sorter<memory_mode::Hybrid, value_type, Comp>>& u_ptr,
+                 size_t memory_bytes,
+                 size_t no_elements,
+                 size_t no_sorters = 1,
+                 Comp comp         = Comp())
+    {
+      reset_unique_with_budget(
+        u_ptr, memory_bytes / no_sorters, memory_bytes, no_elements, no_sorters, comp);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Instantiate with a specific amount of memory for its internal buffer, i.e. with a
+    ///        share of `memory_bytes` that differs from `memory_bytes / no_sorters`. If no memory
+    ///        is given to the internal buffer, then it starts out in external memory with the share
+    ///        `memory_bytes / no_sorters`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static unique_ptr<sorter<memory_mode::Hybrid, value_type, Comp>>
+    make_unique_with_budget(size_t internal_memory,
+                            size_t memory_bytes,
+                            size_t no_elements,
+                            size_t no_sorters = 1,
+                            Comp comp         = Comp())
+    {
+      return adiar::make_unique<sorter<memory_mode::Hybrid, value_type, Comp>>(
+        internal_memory, memory_bytes, no_elements, no_sorters, comp);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Reset with a (possibly different) amount of memory for its internal buffer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static void
+    reset_unique_with_budget(unique_ptr<sorter<memory_mode::Hybrid, value_type, Comp>>& u_ptr,
+                             size_t internal_memory,
+                             size_t memory_bytes,
+                             size_t no_elements,
+                             size_t no_sorters = 1,
+                             Comp comp         = Comp())
+    {
+      // Reuse the internal buffer, unless it has already been given up or it is resized.
+      const bool reusable = !u_ptr->spilled() && u_ptr->_internal_memory == internal_memory
+        && u_ptr->_internal_sorter->capacity() == internal_capacity(internal_memory, no_elements);
+
+      if (!reusable) {
+        u_ptr = nullptr;
+        u_ptr =
+          make_unique_with_budget(internal_memory, memory_bytes, no_elements, no_sorters, comp);
+      } else {
+        // As for the internal sorter, the comparator of the reused buffer is kept.
+        u_ptr->_internal_sorter->reset();
+        u_ptr->_no_elements = no_elements;
+        u_ptr->_comp        = comp;
+      }
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    sorter(size_t memory_bytes, size_t no_elements, size_t no_sorters = 1, Comp comp = Comp())
+      : sorter(memory_bytes / no_sorters, memory_bytes, no_elements, no_sorters, comp)
+    {}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    sorter(size_t internal_memory,
+           size_t memory_bytes,
+           size_t no_elements,
+           size_t no_sorters,
+           Comp comp)
+      : _internal_memory(internal_memory)
+      , _no_elements(no_elements)
+      , _comp(comp)
+    {
+      adiar_assert(no_sorters > 0, "Number of sorters should be positive");
+      adiar_assert(internal_memory <= memory_bytes, "Budget should be a share of the memory");
+
+      // The other sorters sharing `memory_bytes` may still hold on to their internal buffer. Hence,
+      // an external memory sorter may only use this sorter's share.
+      if (internal_memory == 0u) {
+        _external_sorter =
+          external_sorter_type::make_unique(memory_bytes / no_sorters, no_elements, 1u, comp);
+        return;
+      }
+
+      _internal_sorter = internal_sorter_type::make_unique(
+        internal_memory, internal_capacity(internal_memory, no_elements), 1u, comp);
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements of the internal buffer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    internal_capacity(size_t internal_memory, size_t no_elements)
+    {
+      return std::min(no_elements, internal_sorter_type::memory_fits(internal_memory));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the next element to pull is the one of the sorted run.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    pull_from_spill()
+    {
+      adiar_assert(spilled(), "Sorted run only exists after spilling");
+
+      if (!_spill_stream.is_open() || !_spill_stream.can_read()) { return false; }
+      if (!_external_sorter->can_pull()) { return true; }
+      return !_comp(_external_sorter->top(), _spill_stream.peek());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Move all buffered elements into a sorted run on disk and continue with an external
+    ///        memory sorter.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    spill()
+    {
+      adiar_assert(!spilled(), "Can only spill once");
+
+      _spill_stream.open();
+
+      _internal_sorter->sort();
+      while (_internal_sorter->can_pull()) { _spill_stream.write(_internal_sorter->pull()); }
+      _internal_sorter = nullptr;
+
+      // The other sorters sharing the memory may still hold on to their internal buffer. Hence,
+      // the external memory sorter (and the stream of the sorted run) may only use the share of
+      // the internal buffer just released.
+      const size_t spill_memory    = spill_stream_type::memory_usage();
+      const size_t external_memory =
+        spill_memory < _internal_memory ? _internal_memory - spill_memory : 0u;
+
+      _external_sorter =
+        external_sorter_type::make_unique(external_memory, _no_elements, 1u, _comp);
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the content has been moved to external memory.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    spilled() const
+    {
+      return static_cast<bool>(_external_sorter);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    push(const value_type& v)
+    {
+      if (!spilled() && !_internal_sorter->can_push()) { spill(); }
+
+      if (spilled()) {
+        _external_sorter->push(v);
+      } else {
+        _internal_sorter->push(v);
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    sort()
+    {
+      if (spilled()) {
+        _external_sorter->sort();
+        if (_spill_stream.is_open()) { _spill_stream.seek(0); }
+      } else {
+        _internal_sorter->sort();
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    can_pull() /*const*/
+    {
+      if (!spilled()) { return _internal_sorter->can_pull(); }
+      return _external_sorter->can_pull() || pull_from_spill();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    value_type
+    top()
+    {
+      if (!spilled()) { return _internal_sorter->top(); }
+      return pull_from_spill() ? _spill_stream.peek() : _external_sorter->top();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    value_type
+    pull()
+    {
+      if (!spilled()) { return _internal_sorter->pull(); }
+      if (pull_from_spill()) {
+        _spill_pulls++;
+        return _spill_stream.read();
+      }
+      return _external_sorter->pull();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    size() /*const*/
+    {
+      if (!spilled()) { return _internal_sorter->size(); }
+
+      const size_t spill_size = _spill_stream.is_open() ? _spill_stream.size() - _spill_pulls : 0u;
+      return _external_sorter->size() + spill_size;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    empty() /*const*/
+    {
+      return size() == 0;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Type alias for sorter for partial type application of the 'hybrid' memory type.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp = std::less<T>>
+  using hybrid_sorter = sorter<memory_mode::Hybrid, T, Comp>;
 }
 
 #endif // ADIAR_INTERNAL_DATA_STRUCTURES_SORTER_H
@@ -1,7 +1,14 @@
 #ifndef ADIAR_INTERNAL_DATA_STRUCTURES_STACK_H
 #define ADIAR_INTERNAL_DATA_STRUCTURES_STACK_H
 
+#include <limits>
+#include <memory>
+
 #include <tpie/internal_stack.h>
+#include <tpie/stack.h>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/memory.h>
 
 namespace adiar::internal
 {
@@ -18,7 +25,26 @@ namespace adiar::internal
     using value_type = T;
 
   private:
-    tpie::internal_stack<T> _stack;
+    using stack_type = tpie::internal_stack<T>;
+
+    stack_type _stack;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage(size_t capacity)
+    {
+      return stack_type::memory_usage(capacity);
+    }
+
+    static size_t
+    memory_fits(size_t memory_bytes)
+    {
+      const size_t c = stack_type::memory_fits(memory_bytes);
+
+      adiar_assert(memory_usage(c) <= memory_bytes, "memory_fits and memory_usage should agree.");
+      return c;
+    }
 
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -86,9 +112,112 @@ namespace adiar::internal
   };
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  /// \brief An external memory stack in TPIE.
+  /// \brief Alias for a `stack<memory_mode::Internal, T>`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  using internal_stack = stack<memory_mode::Internal, T>;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Wrapper for TPIE's external memory stack.
+  ///
+  /// \details The elements are placed in a temporary file on disk, where only the top-most block is
+  ///          kept in memory. Hence, the memory usage is independent of the stack's capacity.
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  // TODO Implement an external memory (temporary) stack (see example in TPIE's documentation).
+  template <typename T>
+  class stack<memory_mode::External, T>
+  {
+  public:
+    using value_type = T;
+
+  private:
+    using stack_type = tpie::stack<T>;
+
+    /// \brief The underlying TPIE stack. This is a pointer, since `clear()` needs to replace it
+    ///        (TPIE's stack does not provide any way to truncate its underlying file).
+    unique_ptr<stack_type> _stack;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage(size_t /*capacity*/ = 0)
+    {
+      return stack_type::memory_usage();
+    }
+
+    static size_t
+    memory_fits(size_t memory_bytes)
+    {
+      return memory_usage() <= memory_bytes ? std::numeric_limits<size_t>::max() : 0u;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    stack(size_t /*capacity*/ = 0)
+      : _stack(adiar::make_unique<stack_type>())
+    {}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    value_type
+    top() // const
+    {
+      return this->_stack->top();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    pop()
+    {
+      this->_stack->pop();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    value_type
+    pull()
+    {
+      return this->_stack->pop();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    push(const value_type& v)
+    {
+      this->_stack->push(v);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    size() const
+    {
+      return this->_stack->size();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    empty() const
+    {
+      return this->_stack->empty();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    clear()
+    {
+      this->_stack = adiar::make_unique<stack_type>();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    clear(size_t /*new_capacity*/)
+    {
+      this->clear();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Alias for a `stack<memory_mode::External, T>`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  using external_stack = stack<memory_mode::External, T>;
 }
 
 #endif // ADIAR_INTERNAL_DATA_STRUCTURES_STACK_H
@@ -1,9 +1,14 @@
 #ifndef ADIAR_INTERNAL_DATA_STRUCTURES_VECTOR_H
 #define ADIAR_INTERNAL_DATA_STRUCTURES_VECTOR_H
 
+#include <iterator>
+#include <limits>
+
+#include <tpie/file_stream.h>
 #include <tpie/internal_vector.h>
 
 #include <adiar/internal/assert.h>
+#include <adiar/internal/memory.h>
 
 namespace adiar::internal
 {
@@ -212,9 +217,233 @@ namespace adiar::internal
   using internal_vector = vector<memory_mode::Internal, T>;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  /// \brief An external memory vector in TPIE.
+  /// \brief Wrapper for a temporary TPIE file to match the (read-only part of the) interface of
+  ///        `std::vector`.
+  ///
+  /// \details Only a single block of the file is kept in memory, i.e. its memory usage is
+  ///          independent of its capacity. Since elements are not in memory, they are only
+  ///          provided by value (and not by reference). All iterators are read-only and share the
+  ///          vector's underlying stream. This is cheap as long as they move (mostly) in tandem
+  ///          block by block.
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  // TODO Implement an external memory (temporary) vector (wrapper on `file`, I suppose).
+  template <typename T>
+  class vector<memory_mode::External, T>
+  {
+  private:
+    using stream_type = tpie::file_stream<T>;
+
+    /// \brief The underlying stream to the temporary file.
+    ///
+    /// \remark This variable is made 'mutable' to allow seeking within a 'const' context.
+    mutable stream_type _stream;
+
+    /// \brief The number of elements placed in the vector. Due to `pop_back()`, the underlying file
+    ///        may be larger.
+    size_t _size = 0;
+
+  public:
+    using value_type = T;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Read-only random access iterator for an external memory vector.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    class const_iterator
+    {
+    public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type        = T;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = const T*;
+      using reference         = T;
+
+    private:
+      const vector* _vec = nullptr;
+      size_t _idx        = 0;
+
+    public:
+      const_iterator() = default;
+
+      const_iterator(const vector* vec, size_t idx)
+        : _vec(vec)
+        , _idx(idx)
+      {}
+
+      reference
+      operator*() const
+      {
+        return this->_vec->at(this->_idx);
+      }
+
+      const_iterator&
+      operator++()
+      {
+        ++this->_idx;
+        return *this;
+      }
+
+      const_iterator
+      operator++(int)
+      {
+        const const_iterator res = *this;
+        ++this->_idx;
+        return res;
+      }
+
+      const_iterator&
+      operator--()
+      {
+        --this->_idx;
+        return *this;
+      }
+
+      const_iterator
+      operator--(int)
+      {
+        const const_iterator res = *this;
+        --this->_idx;
+        return res;
+      }
+
+      bool
+      operator==(const const_iterator& o) const
+      {
+        return this->_vec == o._vec && this->_idx == o._idx;
+      }
+
+      bool
+      operator!=(const const_iterator& o) const
+      {
+        return !(*this == o);
+      }
+
+      difference_type
+      operator-(const const_iterator& o) const
+      {
+        return static_cast<difference_type>(this->_idx) - static_cast<difference_type>(o._idx);
+      }
+    };
+
+    using iterator               = const_iterator;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using reverse_iterator       = const_reverse_iterator;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage(size_t /*capacity*/ = 0)
+    {
+      return stream_type::memory_usage();
+    }
+
+    static size_t
+    memory_fits(size_t memory_bytes)
+    {
+      return memory_usage() <= memory_bytes ? std::numeric_limits<size_t>::max() : 0u;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    vector(size_t /*capacity*/ = 0)
+    {
+      this->_stream.open();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    value_type
+    at(size_t i) const
+    {
+      adiar_assert(i < this->size(), "Use of invalid index!");
+      if (this->_stream.offset() != i) { this->_stream.seek(i); }
+      return this->_stream.read();
+    }
+
+    value_type
+    operator[](size_t i) const
+    {
+      return this->at(i);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    value_type
+    front() const
+    {
+      return this->at(0);
+    }
+
+    value_type
+    back() const
+    {
+      return this->at(this->_size - 1);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    value_type
+    push_back(const value_type& x)
+    {
+      if (this->_stream.offset() != this->_size) { this->_stream.seek(this->_size); }
+      this->_stream.write(x);
+      this->_size += 1;
+      return x;
+    }
+
+    void
+    pop_back()
+    {
+      adiar_assert(!this->empty(), "Cannot pop from an empty vector");
+      this->_size -= 1;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const_iterator
+    begin() const
+    {
+      return const_iterator(this, 0);
+    }
+
+    const_iterator
+    end() const
+    {
+      return const_iterator(this, this->_size);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const_reverse_iterator
+    rbegin() const
+    {
+      return const_reverse_iterator(this->end());
+    }
+
+    const_reverse_iterator
+    rend() const
+    {
+      return const_reverse_iterator(this->begin());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    size() const
+    {
+      return this->_size;
+    }
+
+    bool
+    empty() const
+    {
+      return this->_size == 0;
+    }
+
+    size_t
+    capacity() const
+    {
+      return std::numeric_limits<size_t>::max();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Alias for a `vector<memory_mode::External, T>`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  using external_vector = vector<memory_mode::External, T>;
 }
 
 #endif // ADIAR_INTERNAL_DATA_STRUCTURES_VECTOR_H
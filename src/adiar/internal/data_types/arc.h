@@ -261,6 +261,16 @@ namespace adiar::internal
     {
       return a.source() < b.source();
     }
+
+    /// \brief Number of words of the key for radix sorting.
+    static constexpr size_t radix_words = 1u;
+
+    /// \brief Key for radix sorting.
+    static uint64_t
+    radix_key(const arc& a, size_t /*w*/)
+    {
+      return a.source().raw();
+    }
   };
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -278,6 +288,20 @@ namespace adiar::internal
 #endif
         ;
     }
+
+    /// \brief Number of words of the key for radix sorting.
+#ifndef NDEBUG
+    static constexpr size_t radix_words = 2u;
+#else
+    static constexpr size_t radix_words = 1u;
+#endif
+
+    /// \brief Key for radix sorting.
+    static uint64_t
+    radix_key(const arc& a, size_t w)
+    {
+      return w == 0u ? a.target().raw() : a.source().raw();
+    }
   };
 }
 
@@ -1,6 +1,9 @@
 #ifndef ADIAR_INTERNAL_DATA_TYPES_LEVEL_INFO_H
 #define ADIAR_INTERNAL_DATA_TYPES_LEVEL_INFO_H
 
+#include <cstdint>
+#include <limits>
+
 #include <adiar/internal/assert.h>
 #include <adiar/internal/data_types/ptr.h>
 
@@ -34,10 +37,24 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     using signed_label_type = ptr_uint64::signed_level_type;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the (internal) 2-level cut stored with a level.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using cut_type = uint32_t;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Value for a level without any known 2-level cut.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr cut_type no_cut = std::numeric_limits<cut_type>::max();
+
     /* ========================================== VARIABLES ===================================== */
   private:
     level_type _level; // cppcheck-suppress [uninitMemberVar]
-    size_t _width;     // cppcheck-suppress [uninitMemberVar]
+
+    // The cut is placed in what otherwise would be padding between `_level` and `_width`. Hence,
+    // the size of a `level_info` is unchanged.
+    cut_type _cut; // cppcheck-suppress [uninitMemberVar]
+    size_t _width; // cppcheck-suppress [uninitMemberVar]
 
     /* ======================================== CONSTRUCTORS ==================================== */
   public:
@@ -78,7 +95,21 @@ namespace adiar::internal
     ///        variable ordering.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     explicit level_info(level_type level, size_t width)
+      : level_info(level, width, no_cut)
+    {}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Create a level_info for a variable, a certain width, and an upper bound on the
+    ///          2-level cut through this level and the next one.
+    ///
+    /// \details The `max_2level_cut` bounds the number of arcs to an internal node that cross any
+    ///          cut through this level and the next (deeper) level of the diagram, e.g. the arcs into
+    ///          this level, the arcs out of or past it, and the arcs out of the next level. If it is
+    ///          too large to be stored, then it is recorded as unknown.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    explicit level_info(level_type level, size_t width, size_t max_2level_cut)
       : _level(level)
+      , _cut(max_2level_cut < no_cut ? static_cast<cut_type>(max_2level_cut) : no_cut)
       , _width(width)
     {
       adiar_assert(level <= ptr_uint64::max_label, "Level should be valid in 'ptr_uint64'");
@@ -134,10 +165,33 @@ namespace adiar::internal
       return this->_width;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether an upper bound on the 2-level cut through this level and the next is known.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    has_max_2level_cut() const
+    {
+      return this->_cut != no_cut;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain an upper bound on the 2-level cut through this level and the next one.
+    ///
+    /// \pre `has_max_2level_cut()` is true.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    max_2level_cut() const
+    {
+      adiar_assert(this->has_max_2level_cut(), "Cut should be known");
+      return this->_cut;
+    }
+
     /* ========================================= OPERATORS ====================================== */
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \brief Whether all entries on this level match.
+    /// \brief Whether the level and its width match.
+    ///
+    /// \remark The cut is only an upper bound and hence is not part of the comparison.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     inline bool
     operator==(const level_info& o) const
@@ -178,6 +232,7 @@ namespace adiar::internal
       stream << this->level() << " (x" << this->label() << ")";
       stream << " | ";
       stream << "width: " << this->width();
+      if (this->has_max_2level_cut()) { stream << ", 2-level cut: " << this->max_2level_cut(); }
       stream << " }";
 
       return stream.str();
@@ -209,7 +264,8 @@ namespace adiar::internal
     const level_type new_level =
       static_cast<level_type>(static_cast<signed_level_type>(li.level()) + levels);
 
-    return level_info(new_level, li.width());
+    return li.has_max_2level_cut() ? level_info(new_level, li.width(), li.max_2level_cut())
+                                   : level_info(new_level, li.width());
   }
 }
 
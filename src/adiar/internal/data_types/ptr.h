@@ -622,6 +622,17 @@ namespace adiar::internal
 
     /* ======================================== COMPARATOR ====================================== */
   public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The raw (packed) value on which all of the comparators below are defined.
+    ///
+    /// \details This is used to sort pointers with a radix sort.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline raw_type
+    raw() const
+    {
+      return this->_raw;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Lexicographical ordering on internal nodes (i, id), followed by terminals `false`,
     ///        `true`, and finally `nil`.
@@ -6,6 +6,7 @@
 #include <string>
 
 #include <adiar/internal/assert.h>
+#include <adiar/internal/data_structures/radix_sort.h>
 #include <adiar/internal/data_types/node.h>
 #include <adiar/internal/data_types/tuple.h>
 
@@ -423,6 +424,16 @@ namespace adiar::internal
 
       return label_a < label_b || (label_a == label_b && a.target < b.target);
     }
+
+    /// \brief Number of words of the key for radix sorting.
+    static constexpr size_t radix_words = 1u + Request::cardinality;
+
+    /// \brief Key for radix sorting.
+    static uint64_t
+    radix_key(const Request& r, size_t w)
+    {
+      return w == 0u ? r.target.first().label() : r.target[w - 1u].raw();
+    }
   };
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -437,6 +448,17 @@ namespace adiar::internal
     {
       return tuple_first_lt<typename Request::target_t>()(a.target, b.target);
     }
+
+    /// \brief Number of words of the key for radix sorting.
+    static constexpr size_t radix_words =
+      Request::cardinality == 1u ? 1u : 1u + Request::cardinality;
+
+    /// \brief Key for radix sorting.
+    static uint64_t
+    radix_key(const Request& r, size_t w)
+    {
+      return w == 0u ? r.target.first().raw() : r.target[w - 1u].raw();
+    }
   };
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -626,6 +648,29 @@ namespace adiar::internal
       }
       return RequestComp()(a, b);
     }
+
+    /// \brief Number of words of the key for radix sorting (if any).
+    ///
+    /// \details Tie-breaking on the data cannot be expressed as a key.
+    static constexpr size_t radix_words =
+      Request::data_type::sort_on_tiebreak || !has_radix_key_v<RequestComp, Request>
+      ? 0u
+      : (Request::data_type::has_level ? 1u : 0u) + radix_words_of<RequestComp, Request>::value;
+
+    /// \brief Key for radix sorting.
+    static uint64_t
+    radix_key(const Request& r, size_t w)
+    {
+      if constexpr (Request::data_type::has_level) {
+        if (w == 0u) { return r.level(); }
+        w -= 1u;
+      }
+      if constexpr (has_radix_key_v<RequestComp, Request>) {
+        return RequestComp::radix_key(r, w);
+      } else {
+        return 0u;
+      }
+    }
   };
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -790,6 +835,57 @@ namespace adiar::internal
       return with_parent::to_string() + ", " + with_level::to_string();
     }
   };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Class to carry the parent of a recursion within `request_data` together with which of
+  ///        multiple outputs it belongs to.
+  ///
+  /// \details Used by algorithms that sweep over multiple roots at once.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class with_output_and_parent
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the output and parent should be part of resolving sorting two requests.
+    ///
+    /// \details This is always true, since requests for the same target but for different outputs
+    ///          need to be grouped by their output.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr bool sort_on_tiebreak = true;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The fact that this data does not contain a level.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr bool has_level = false;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of the output the request belongs to.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t output;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Pointer to the source of the request (within its output).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    node::pointer_type source;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Comparator to break ties based on the output and then the source.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool
+    operator<(const with_output_and_parent& o) const
+    {
+      return this->output < o.output || (this->output == o.output && this->source < o.source);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief String representation of the output and parent data.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::string
+    to_string() const
+    {
+      return std::to_string(output) + ", " + source.to_string();
+    }
+  };
 }
 
 namespace std
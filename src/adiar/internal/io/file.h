@@ -12,6 +12,8 @@
 #include <tpie/tpie.h>
 
 #include <adiar/internal/assert.h>
+#include <adiar/internal/io/file_pool.h>
+#include <adiar/internal/io/temp_dir.h>
 #include <adiar/internal/memory.h>
 
 namespace adiar::internal
@@ -94,10 +96,15 @@ namespace adiar::internal
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Constructor for a new unammed \em temporary file.
+    ///
+    /// \details If multiple temporary directories are in use, then the file is placed in the next
+    ///          one (round-robin). Otherwise, TPIE lazily picks the path within its default one.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     file()
       : _tpie_file()
-    {}
+    {
+      if (1u < temp_dir_count()) { _tpie_file.set_path(temp_dir_path()); }
+    }
 
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -111,6 +118,78 @@ namespace adiar::internal
       if (!exists()) { throw runtime_error("'" + path + "' not found."); }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Move-constructor.
+    ///
+    /// \details The moved-from object is left without a path, i.e. it neither recycles nor deletes
+    ///          the file on disk when destructed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    file(file<value_type>&& o)
+      : _tpie_file()
+    {
+      __steal(o);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Move-assignment.
+    ///
+    /// \details The file previously owned by this object is released as if it was destructed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    file<value_type>&
+    operator=(file<value_type>&& o)
+    {
+      if (this != &o) {
+        __release();
+        __steal(o);
+      }
+      return *this;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Hands a temporary file over to be recycled (if possible) when destructed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ~file()
+    {
+      __release();
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Hand the temporary file over to the pool (if possible).
+    ///
+    /// \remark If the pool rejects it, then TPIE deletes the file as per usual.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __release()
+    {
+      if (is_temp() && exists()) {
+#ifdef ADIAR_STATS
+        temp_dir_account(path());
+#endif
+        file_pool_release(path());
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Take over the path (and persistence) of another file and clear it in the other.
+    ///
+    /// \remark If this object still refers to a temporary file on disk, then TPIE deletes it.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __steal(file<value_type>& o)
+    {
+      const std::string o_path   = o.path();
+      const bool o_is_persistent = o.is_persistent();
+
+      // Mark the other as persistent, such that TPIE does not delete the file when the path is
+      // cleared. Afterwards, it lazily obtains a fresh path (if ever needed).
+      o._tpie_file.set_persistent(true);
+      o._tpie_file.set_path(std::string(), false);
+
+      _tpie_file.set_path(o_path, o_is_persistent);
+    }
+
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Whether this file is persistent or temporary, i.e. the file on disk will \em not be
@@ -185,10 +264,24 @@ namespace adiar::internal
     }
 
   private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief If the file does not exist yet, then try to reuse a recycled file rather than
+    ///        creating a new one.
+    ///
+    /// \remark The recycled file is empty (without even a TPIE header); hence, it is to be
+    ///         immediately opened with write access.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __claim() const
+    {
+      if (is_temp() && !exists()) { file_pool_acquire(path()); }
+    }
+
     void
     __touch() const
     {
       if (exists()) return;
+      __claim();
 
       // The file exists on disk, after opening it with write access.
       tpie::file_stream<value_type> fs;
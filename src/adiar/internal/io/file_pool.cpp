@@ -0,0 +1,166 @@
+#include "file_pool.h"
+
+#include <filesystem>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+#include <adiar/internal/block_size.h>
+#include <adiar/internal/io/temp_dir.h>
+
+namespace adiar::internal
+{
+  statistics::file_pool_t stats_file_pool;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief State of the pool of recycled files.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  struct
+  {
+    /// \brief Lock on the pool's content.
+    std::mutex lock;
+
+    /// \brief Maximum number of files to keep in the pool.
+    size_t capacity = 0u;
+
+    /// \brief Number of files currently in the pool.
+    size_t size = 0u;
+
+    /// \brief Paths of empty files ready to be recycled (per temporary directory).
+    std::vector<std::vector<std::string>> paths;
+  } _file_pool;
+
+  size_t
+  recommended_file_pool_size(size_t memory_limit_bytes)
+  {
+    return memory_limit_bytes / get_block_size();
+  }
+
+  void
+  file_pool_init(size_t capacity)
+  {
+    file_pool_deinit();
+
+    std::lock_guard<std::mutex> guard(_file_pool.lock);
+    _file_pool.capacity = capacity;
+    _file_pool.paths.resize(temp_dir_count());
+  }
+
+  void
+  file_pool_deinit()
+  {
+    std::lock_guard<std::mutex> guard(_file_pool.lock);
+    for (const std::vector<std::string>& dir_paths : _file_pool.paths) {
+      for (const std::string& p : dir_paths) {
+        std::error_code ec;
+        std::filesystem::remove(p, ec);
+      }
+    }
+    _file_pool.paths.clear();
+    _file_pool.capacity = 0u;
+    _file_pool.size     = 0u;
+  }
+
+  size_t
+  file_pool_capacity()
+  {
+    std::lock_guard<std::mutex> guard(_file_pool.lock);
+    return _file_pool.capacity;
+  }
+
+  size_t
+  file_pool_size()
+  {
+    std::lock_guard<std::mutex> guard(_file_pool.lock);
+    return _file_pool.size;
+  }
+
+  bool
+  file_pool_acquire(const std::string& path)
+  {
+    std::lock_guard<std::mutex> guard(_file_pool.lock);
+
+    // Recycled files are only moved within the same directory (and so the same device).
+    const size_t dir_idx = temp_dir_idx(path);
+    if (_file_pool.paths.size() <= dir_idx || _file_pool.paths[dir_idx].empty()) {
+#ifdef ADIAR_STATS
+      stats_file_pool.acquire_miss += 1u;
+#endif
+      return false;
+    }
+
+    const std::string pool_path = std::move(_file_pool.paths[dir_idx].back());
+    _file_pool.paths[dir_idx].pop_back();
+    _file_pool.size -= 1u;
+
+    std::error_code ec;
+    std::filesystem::rename(pool_path, path, ec);
+    if (ec) {
+      // LCOV_EXCL_START
+      std::filesystem::remove(pool_path, ec);
+#ifdef ADIAR_STATS
+      stats_file_pool.acquire_miss += 1u;
+#endif
+      return false;
+      // LCOV_EXCL_STOP
+    }
+
+#ifdef ADIAR_STATS
+    stats_file_pool.acquire_hit += 1u;
+#endif
+    return true;
+  }
+
+  bool
+  file_pool_release(const std::string& path)
+  {
+    std::lock_guard<std::mutex> guard(_file_pool.lock);
+
+    if (_file_pool.capacity <= _file_pool.size) {
+#ifdef ADIAR_STATS
+      stats_file_pool.release_discard += 1u;
+#endif
+      return false;
+    }
+
+    // Files moved elsewhere (e.g. to be persisted) are not recycled.
+    const size_t dir_idx = temp_dir_idx(path);
+    if (_file_pool.paths.size() <= dir_idx) {
+#ifdef ADIAR_STATS
+      stats_file_pool.release_discard += 1u;
+#endif
+      return false;
+    }
+
+    // Truncate the file to give its disk space back but keep the inode.
+    std::error_code ec;
+    std::filesystem::resize_file(path, 0u, ec);
+    if (ec) {
+      // LCOV_EXCL_START
+#ifdef ADIAR_STATS
+      stats_file_pool.release_discard += 1u;
+#endif
+      return false;
+      // LCOV_EXCL_STOP
+    }
+
+    std::string pool_path = temp_dir_path(dir_idx, "pool");
+    std::filesystem::rename(path, pool_path, ec);
+    if (ec) {
+      // LCOV_EXCL_START
+#ifdef ADIAR_STATS
+      stats_file_pool.release_discard += 1u;
+#endif
+      return false;
+      // LCOV_EXCL_STOP
+    }
+
+    _file_pool.paths[dir_idx].push_back(std::move(pool_path));
+    _file_pool.size += 1u;
+
+#ifdef ADIAR_STATS
+    stats_file_pool.release_recycle += 1u;
+#endif
+    return true;
+  }
+}
@@ -7,6 +7,7 @@
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/io/file.h>
+#include <adiar/internal/io/page_cache.h>
 #include <adiar/internal/memory.h>
 
 namespace adiar::internal
@@ -155,7 +156,13 @@ namespace adiar::internal
     void
     close()
     {
-      _stream.close();
+      if (page_cache_evict_enabled() && _stream.is_open()) {
+        const std::string path = _stream.path();
+        _stream.close();
+        page_cache_evict(path, false);
+      } else {
+        _stream.close();
+      }
       if (_file_ptr) { _file_ptr.reset(); }
     }
 
@@ -165,6 +172,7 @@ namespace adiar::internal
     void
     reset()
     {
+      _has_peeked = false;
       if constexpr (Reverse) {
         _stream.seek(0, tpie::file_stream_base::end);
       } else {
@@ -5,6 +5,7 @@
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/io/file.h>
+#include <adiar/internal/io/page_cache.h>
 
 namespace adiar::internal
 {
@@ -136,7 +137,13 @@ namespace adiar::internal
     void
     close()
     {
-      this->_stream.close();
+      if (page_cache_evict_enabled() && this->_stream.is_open()) {
+        const std::string path = this->_stream.path();
+        this->_stream.close();
+        page_cache_evict(path, true);
+      } else {
+        this->_stream.close();
+      }
       if (this->_file_ptr) { this->_file_ptr.reset(); }
     }
 
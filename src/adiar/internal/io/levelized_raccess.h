@@ -3,22 +3,55 @@
 
 #include <tpie/array.h>
 
+#include <adiar/internal/data_structures/buffer_pool.h>
 #include <adiar/internal/dd.h>
 #include <adiar/internal/io/levelized_file.h>
 
 namespace adiar::internal
 {
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief How each element of a level is stored within the buffer of a `levelized_raccess`. By
+  ///        default, the elements are stored as-is.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename ValueType>
+  struct levelized_raccess_identity
+  {
+    /// \brief Type of each entry in the buffer.
+    using stored_type = ValueType;
+
+    /// \brief Type returned when accessing an element.
+    using reference = const ValueType&;
+
+    /// \brief Convert an element (pulled from the stream) to be stored.
+    static const stored_type&
+    pack(const ValueType& v)
+    {
+      return v;
+    }
+
+    /// \brief Obtain the element with the given uid from its stored entry.
+    static reference
+    unpack(const stored_type& s, const typename ValueType::uid_type& /*u*/)
+    {
+      return s;
+    }
+  };
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Random-access to the contents of a levelized file.
   ///
   /// \tparam StreamType Stream to wrap with a *levelized random access* buffer.
+  ///
+  /// \tparam Storage    How elements are stored within the buffer, e.g. to leave out the parts
+  ///                    that can be derived from their index.
   //
   // TODO: Generalize parts of 'node_raccess' to reuse it with levelized files with other
   //       types of content. Yet, what use-case do we have for this?
   //
   // TODO: Support 'StreamType<Reverse>'
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  template <typename StreamType>
+  template <typename StreamType,
+            typename Storage = levelized_raccess_identity<typename StreamType::value_type>>
   class levelized_raccess
   {
   private:
@@ -27,6 +60,9 @@ namespace adiar::internal
   public:
     using value_type = typename stream_type::value_type;
 
+    using stored_type = typename Storage::stored_type;
+    using reference   = typename Storage::reference;
+
     using pointer_type      = typename value_type::pointer_type;
     using uid_type          = typename value_type::uid_type;
     using signed_label_type = typename value_type::signed_label_type;
@@ -36,7 +72,7 @@ namespace adiar::internal
     static size_t
     memory_usage(size_t max_width)
     {
-      return stream_type::memory_usage() + tpie::array<value_type>::memory_usage(max_width);
+      return stream_type::memory_usage() + tpie::array<stored_type>::memory_usage(max_width);
     }
 
   private:
@@ -52,9 +88,9 @@ namespace adiar::internal
     const idx_type _max_width;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \brief Buffer with all elements of the current level.
+    /// \brief Buffer with all elements of the current level (obtained from the `buffer_pool`).
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    tpie::array<value_type> _level_buffer;
+    tpie::array<stored_type> _level_buffer;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Buffer with all elements of the current level.
@@ -92,7 +128,6 @@ namespace adiar::internal
                       const typename T::signed_label_type& shift = 0)
       : _ifstream(f, negate, shift)
       , _max_width(f.width)
-      , _level_buffer(f.width)
       , _root(_ifstream.peek().uid())
     {
       init();
@@ -107,7 +142,6 @@ namespace adiar::internal
                       const typename T::signed_label_type shift = 0)
       : _ifstream(f, negate, shift)
       , _max_width(f.width)
-      , _level_buffer(f.width)
       , _root(_ifstream.peek().uid())
     {
       init();
@@ -122,18 +156,25 @@ namespace adiar::internal
                       const typename T::signed_label_type shift = 0)
       : _ifstream(f, negate, shift)
       , _max_width(f->width)
-      , _level_buffer(f->width)
       , _root(_ifstream.peek().uid())
     {
       init();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ~levelized_raccess()
+    {
+      buffer_pool<stored_type>::release(_level_buffer);
+    }
+
   private:
     void
     init()
     {
       adiar_assert(_ifstream.can_pull(), "given file should be non-empty");
 
+      buffer_pool<stored_type>::acquire(_level_buffer, _max_width);
+
       // Skip the terminal node for terminal only BDDs. This way, 'has_next_level' is a mere
       // 'can_pull' on the underlying stream.
       if (_root.is_terminal()) { _ifstream.pull(); }
@@ -199,7 +240,7 @@ namespace adiar::internal
       // Copy over all elements from the requested level
       while (_ifstream.can_pull()
              && static_cast<signed_label_type>(_ifstream.peek().uid().label()) == level) {
-        _level_buffer[_curr_width++] = _ifstream.pull();
+        _level_buffer[_curr_width++] = Storage::pack(_ifstream.pull());
       }
     }
 
@@ -255,12 +296,34 @@ namespace adiar::internal
     ///
     /// \pre `idx < current_width()`
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    const value_type&
+    reference
     at(idx_type idx) const
+    {
+      return Storage::unpack(stored_at(idx), uid_of(idx));
+    }
+
+  protected:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the stored entry of the current level at the given index.
+    ///
+    /// \pre `idx < current_width()`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const stored_type&
+    stored_at(idx_type idx) const
     {
       adiar_assert(idx < current_width());
       return _level_buffer[idx];
     }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The uid of the element at the given index, assuming the level is *indexable*.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    uid_type
+    uid_of(idx_type idx) const
+    {
+      return uid_type(static_cast<typename pointer_type::label_type>(_curr_level),
+                      (pointer_type::max_id + 1u) - (_curr_width - idx));
+    }
   };
 }
 
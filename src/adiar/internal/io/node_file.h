@@ -102,6 +102,15 @@ namespace adiar::internal
       //////////////////////////////////////////////////////////////////////////////////////////////
       cuts_t max_2level_cut = { cut::max, cut::max, cut::max, cut::max };
 
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief   Number of internal arcs that may be missing from the cut stored with each level.
+      ///
+      /// \details Arcs redirected by Reduction Rule 1 skip over levels that have already been
+      ///          recorded. Hence, the cut of a level (see `level_info::max_2level_cut`) is only an
+      ///          upper bound after adding this value to it.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      cut::size_type level_cut_slack = 0u;
+
       //////////////////////////////////////////////////////////////////////////////////////////////
       /// \brief The number of false and true terminals in the file. Index 0 gives the number of
       ///        false terminals and index 1 gives the number of true terminals.
@@ -60,6 +60,20 @@ namespace adiar::internal
     node::pointer_type _long_internal_ptr        = node::pointer_type::nil();
     cut::size_type _number_of_long_internal_arcs = 0u;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Variables for 2-level cut
+    //
+    // If every level is pushed together with an upper bound on the 2-level cut through it and the
+    // level below, then the maximum 2-level cut is the largest of these. To derive the bound of a
+    // level, one needs the number of arcs out of the level below it.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool _has_level_cuts = true;
+
+    cut::size_type _max_2level_internal = 0u;
+
+    cut::size_type _curr_level_outdegree = 0u;
+    cut::size_type _prev_level_outdegree = 0u;
+
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Construct unattached to any levelized node file.
@@ -117,6 +131,12 @@ namespace adiar::internal
 
       _long_internal_ptr            = node::pointer_type::nil();
       _number_of_long_internal_arcs = 0u;
+
+      _has_level_cuts      = true;
+      _max_2level_internal = 0u;
+
+      _curr_level_outdegree = 0u;
+      _prev_level_outdegree = 0u;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -282,7 +302,12 @@ namespace adiar::internal
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \brief Write directly to level information file without any checks.
+    /// \brief   Write directly to level information file without any checks.
+    ///
+    /// \details If all levels are pushed with their 2-level cut, then these are used to derive the
+    ///          maximum 2-level cut of the entire file.
+    ///
+    /// \see     unsafe_outdegree_below
     ////////////////////////////////////////////////////////////////////////////////////////////////
     void
     unsafe_push(const level_info& m)
@@ -291,9 +316,34 @@ namespace adiar::internal
       stats_node_file.push_level += 1;
 #endif
       _file_ptr->width = std::max<size_t>(_file_ptr->width, m.width());
+
+      if (m.has_max_2level_cut()) {
+        _max_2level_internal = std::max(_max_2level_internal, m.max_2level_cut());
+      } else {
+        _has_level_cuts = false;
+      }
+
+      _prev_level_outdegree = _curr_level_outdegree;
+      _curr_level_outdegree = 0u;
+
       levelized_ofstream::push(m);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Number of arcs to internal nodes out of the level that was pushed prior to the
+    ///          current one.
+    ///
+    /// \details Assuming the nodes of each level are pushed (bottom-up) before its `level_info`,
+    ///          this is the out-degree of the level below the one currently being pushed. Together
+    ///          with the arcs into and across the current level, this bounds the 2-level cut of the
+    ///          current level and the one below.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    cut::size_type
+    unsafe_outdegree_below() const
+    {
+      return _prev_level_outdegree;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Write directly to the underlying node file without any checks.
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -306,6 +356,8 @@ namespace adiar::internal
       if (n.low().is_terminal()) { _file_ptr->number_of_terminals[n.low().value()]++; }
       if (n.high().is_terminal()) { _file_ptr->number_of_terminals[n.high().value()]++; }
 
+      if (!n.is_terminal()) { _curr_level_outdegree += n.low().is_node() + n.high().is_node(); }
+
       levelized_ofstream::template push<0>(n);
     }
 
@@ -328,12 +380,25 @@ namespace adiar::internal
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \brief Increase the current maximum 1-level cut size by the given cut.
+    /// \brief   Increase the current maximum 1-level cut size by the given cut.
+    ///
+    /// \details These arcs are not part of the cut pushed with each level. Hence, the internal arcs
+    ///          are also added to the slack of the per-level cuts.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     void
     unsafe_inc_1level_cut(const cuts_t& o)
     {
       inc_cut(_file_ptr->max_1level_cut, o);
+      _file_ptr->level_cut_slack += o[cut::Internal];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Overwrite the number of internal arcs missing from the cut pushed with each level.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    unsafe_set_level_cut_slack(const cut::size_type slack)
+    {
+      _file_ptr->level_cut_slack = slack;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -451,6 +516,15 @@ namespace adiar::internal
           _file_ptr->max_2level_cut[ct] = _file_ptr->max_1level_cut[ct];
         }
       } else { // General case
+        // Upper bound based on the 2-level cut of each level and the one below (if all of them are
+        // known). These only miss the arcs in the slack.
+        const cut::size_type slack = _file_ptr->level_cut_slack;
+
+        const cut::size_type level_cuts_internal =
+          _has_level_cuts && 0u < number_of_levels && slack < cut::max - _max_2level_internal
+          ? _max_2level_internal + slack
+          : cut::max;
+
         for (size_t ct = 0u; ct < cut::size; ct++) {
           // Upper bound based on 1-level cut
           const cut::size_type ub_from_1level_cut = _file_ptr->max_1level_cut[ct] < cut::max / 3u
@@ -458,9 +532,20 @@ namespace adiar::internal
                + (_file_ptr->max_1level_cut[ct] - _file_ptr->max_1level_cut[cut::Internal]))
             : cut::max;
 
+          // Upper bound based on the per-level cuts (plus all arcs to the included terminals).
+          const size_t terminal_arcs = (cut(ct).includes(false) ? number_of_false : 0u)
+            + (cut(ct).includes(true) ? number_of_true : 0u);
+
+          const cut::size_type ub_from_level_cuts = level_cuts_internal < cut::max - terminal_arcs
+            ? std::max(level_cuts_internal + terminal_arcs, _file_ptr->max_1level_cut[ct])
+            : cut::max;
+
           // Use smallest sound upper bound.
-          _file_ptr->max_2level_cut[ct] = std::min(
-            { _file_ptr->max_2level_cut[ct], ub_from_1level_cut, max_cut, all_arcs_cut[ct] });
+          _file_ptr->max_2level_cut[ct] = std::min({ _file_ptr->max_2level_cut[ct],
+                                                     ub_from_1level_cut,
+                                                     ub_from_level_cuts,
+                                                     max_cut,
+                                                     all_arcs_cut[ct] });
         }
       }
     }
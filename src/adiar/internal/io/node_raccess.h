@@ -9,12 +9,37 @@
 
 namespace adiar::internal
 {
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Storage of only the children of each node within the buffer of a `node_raccess`.
+  ///
+  /// \details On an indexable level, the uid of a node is derived from its index. Leaving it out
+  ///          shrinks each entry from 24 to 16 bytes. Hence, the buffer takes up a third less
+  ///          memory and no pair of children crosses a cache line.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  struct node_raccess_children
+  {
+    using stored_type = node::children_type;
+    using reference   = node;
+
+    static stored_type
+    pack(const node& n)
+    {
+      return n.children();
+    }
+
+    static reference
+    unpack(const stored_type& c, const node::uid_type& u)
+    {
+      return node(u, c[false], c[true]);
+    }
+  };
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Random-access to the contents of a levelized file of node.
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  class node_raccess : public levelized_raccess<node_ifstream<>>
+  class node_raccess : public levelized_raccess<node_ifstream<>, node_raccess_children>
   {
-    using parent_type = levelized_raccess<node_ifstream<>>;
+    using parent_type = levelized_raccess<node_ifstream<>, node_raccess_children>;
 
   public:
     static size_t
@@ -72,7 +97,7 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Obtain the node at the given index.
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    const value_type&
+    value_type
     at(idx_type idx) const
     {
       // To properly support overloading with both 'idx' and 'uid', we need both in this class.
@@ -82,14 +107,31 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Obtain the node with the given *uid* (pointer).
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    const value_type&
+    value_type
     at(pointer_type p) const
+    {
+      return parent_type::at(idx_of(p));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the children of the node with the given *uid* (pointer).
+    ///
+    /// \details Unlike `at(p).children()`, this does not recreate the node.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const value_type::children_type&
+    children(pointer_type p) const
+    {
+      return parent_type::stored_at(idx_of(p));
+    }
+
+  private:
+    idx_type
+    idx_of(pointer_type p) const
     {
       adiar_assert(!p.is_nil());
       adiar_assert(static_cast<signed_label_type>(p.label()) == this->current_level());
 
-      const idx_type idx = this->current_width() - ((pointer_type::max_id + 1u) - p.id());
-      return parent_type::at(idx);
+      return this->current_width() - ((pointer_type::max_id + 1u) - p.id());
     }
   };
 }
@@ -8,6 +8,7 @@
 #include <adiar/internal/data_types/level_info.h>
 #include <adiar/internal/data_types/ptr.h>
 #include <adiar/internal/io/file.h>
+#include <adiar/internal/io/page_cache.h>
 #include <adiar/internal/memory.h>
 
 namespace adiar::internal
@@ -94,6 +95,7 @@ namespace adiar::internal
       if (is_open()) { close(); }
       _file_ptr = p;
 
+      f.__claim();
       _stream.open(f._tpie_file, file<value_type>::w_access);
       _stream.seek(0, tpie::file_stream_base::end);
     }
@@ -144,7 +146,13 @@ namespace adiar::internal
     void
     close()
     {
-      _stream.close();
+      if (page_cache_evict_enabled() && _stream.is_open()) {
+        const std::string path = _stream.path();
+        _stream.close();
+        page_cache_evict(path, true);
+      } else {
+        _stream.close();
+      }
       if (_file_ptr) { _file_ptr.reset(); }
     }
 
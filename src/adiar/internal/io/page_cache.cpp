@@ -0,0 +1,26 @@
+#include "page_cache.h"
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace adiar::internal
+{
+  bool _page_cache_evict = false;
+
+  void
+  page_cache_evict([[maybe_unused]] const std::string& path, [[maybe_unused]] const bool written)
+  {
+#if defined(__unix__) && defined(POSIX_FADV_DONTNEED)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) { return; }
+
+    // Dirty pages are skipped by the eviction. Hence, they have to be written back first.
+    if (written) { ::fdatasync(fd); }
+
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+#endif
+  }
+}
@@ -0,0 +1,58 @@
+#ifndef ADIAR_INTERNAL_IO_PAGE_CACHE_H
+#define ADIAR_INTERNAL_IO_PAGE_CACHE_H
+
+#include <string>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether Adiar's files should be evicted from the operating system's page cache.
+  ///
+  /// \see page_cache_evict_set
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  extern bool _page_cache_evict;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Set whether Adiar's files should be evicted from the operating system's page cache.
+  ///
+  /// \details TPIE already buffers each stream within the memory given to Adiar. Hence, the page
+  ///          cache only doubles the amount of memory used per block and evicts the pages of other
+  ///          processes. When turned on, each file is evicted from the page cache when a stream to
+  ///          it is closed.
+  ///
+  /// \remark  This is not `O_DIRECT`: the pages of a file are still cached while it is being
+  ///          written and read. Furthermore, a file that has been written to is first flushed to
+  ///          disk, since the operating system does not evict dirty pages.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline void
+  page_cache_evict_set(const bool enabled)
+  {
+    _page_cache_evict = enabled;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether Adiar's files should be evicted from the page cache.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline bool
+  page_cache_evict_enabled()
+  {
+    return _page_cache_evict;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Evict the pages of the file at the given path from the page cache.
+  ///
+  /// \details Dirty pages are skipped by the operating system. Hence, if the file has been written
+  ///          to, then it is first flushed to disk with `fdatasync`.
+  ///
+  /// \param path    Path of the file (with no stream attached to it).
+  ///
+  /// \param written Whether the file may have dirty pages, i.e. whether it has been written to.
+  ///
+  /// \remark  On platforms without `posix_fadvise`, this is a no-op.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  page_cache_evict(const std::string& path, const bool written);
+}
+
+#endif // ADIAR_INTERNAL_IO_PAGE_CACHE_H
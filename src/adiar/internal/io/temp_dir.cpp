@@ -0,0 +1,114 @@
+#include "temp_dir.h"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <system_error>
+
+#include <tpie/tempname.h>
+
+#include <adiar/internal/assert.h>
+
+namespace adiar::internal
+{
+  statistics::temp_dirs_t stats_temp_dirs;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Directory of a file path (normalised to be comparable).
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline std::filesystem::path
+  __dir_of(const std::string& path)
+  {
+    return std::filesystem::path(path).lexically_normal().parent_path();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The temporary directories as given by the user.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<std::string> _temp_dirs;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The temporary directories (normalised to be comparable).
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::vector<std::filesystem::path> _temp_dirs__normalized;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Round-robin counter for the next directory to use.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::atomic<size_t> _temp_dirs__next = 0u;
+
+  void
+  temp_dir_init(const std::vector<std::string>& dirs)
+  {
+    temp_dir_deinit();
+
+    if (dirs.empty()) {
+      // Use TPIE's default directory. To get the exact same path as TPIE will use for its own
+      // files, derive it from a file name.
+      _temp_dirs.push_back("");
+      _temp_dirs__normalized.push_back(__dir_of(tpie::tempname::tpie_name()));
+    } else {
+      for (const std::string& d : dirs) {
+        std::error_code ec;
+        std::filesystem::create_directories(d, ec);
+
+        _temp_dirs.push_back(d);
+        _temp_dirs__normalized.push_back(__dir_of(tpie::tempname::tpie_name("", d)));
+      }
+    }
+  }
+
+  void
+  temp_dir_deinit()
+  {
+    _temp_dirs.clear();
+    _temp_dirs__normalized.clear();
+    _temp_dirs__next = 0u;
+  }
+
+  size_t
+  temp_dir_count()
+  {
+    return _temp_dirs.size();
+  }
+
+  size_t
+  temp_dir_idx(const std::string& path)
+  {
+    const std::filesystem::path dir = __dir_of(path);
+    for (size_t idx = 0u; idx < _temp_dirs__normalized.size(); ++idx) {
+      if (_temp_dirs__normalized[idx] == dir) { return idx; }
+    }
+    return _temp_dirs__normalized.size();
+  }
+
+  void
+  temp_dir_account(const std::string& path)
+  {
+    constexpr size_t max_dirs = statistics::temp_dirs_t::max_dirs;
+
+    const size_t idx = temp_dir_idx(path);
+    if (_temp_dirs.size() <= idx) { return; }
+
+    std::error_code ec;
+    const uintmax_t bytes = std::filesystem::file_size(path, ec);
+
+    statistics::temp_dirs_t::dir_t& s = stats_temp_dirs.dirs[std::min(idx, max_dirs - 1)];
+    s.files += 1u;
+    if (!ec) { s.bytes += bytes; }
+  }
+
+  std::string
+  temp_dir_path(const std::string& post_base)
+  {
+    if (_temp_dirs.size() <= 1u) { return tpie::tempname::tpie_name(post_base); }
+    return temp_dir_path(_temp_dirs__next++ % _temp_dirs.size(), post_base);
+  }
+
+  std::string
+  temp_dir_path(const size_t idx, const std::string& post_base)
+  {
+    adiar_assert(idx < _temp_dirs.size(), "Index must be within interval [0;temp_dir_count()-1]");
+    return tpie::tempname::tpie_name(post_base, _temp_dirs[idx]);
+  }
+}
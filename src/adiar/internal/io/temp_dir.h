@@ -0,0 +1,77 @@
+#ifndef ADIAR_INTERNAL_IO_TEMP_DIR_H
+#define ADIAR_INTERNAL_IO_TEMP_DIR_H
+
+#include <string>
+#include <vector>
+
+#include <adiar/statistics.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Struct holding statistics on the usage of each temporary directory.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  extern statistics::temp_dirs_t stats_temp_dirs;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Set up the directories in which Adiar places its temporary files.
+  ///
+  /// \details If multiple directories are given (preferably on different drives), then new files
+  ///          are distributed among them in a round-robin fashion. Since (almost) all of Adiar's
+  ///          algorithms read the output of the previous one while writing a new one, this places
+  ///          the input and output streams on different drives.
+  ///
+  ///          TPIE's own temporary files, e.g. the runs of a sorter, are placed in the first
+  ///          directory.
+  ///
+  /// \param dirs The directories to use. If empty, then TPIE's default path is used.
+  ///
+  /// \pre TPIE is initialised.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  temp_dir_init(const std::vector<std::string>& dirs);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Forget all temporary directories.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  temp_dir_deinit();
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of temporary directories in use.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  size_t
+  temp_dir_count();
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Index of the temporary directory a path resides in.
+  ///
+  /// \returns A value in `[0; temp_dir_count())` or `temp_dir_count()` if `path` is not within any
+  ///          of the temporary directories.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  size_t
+  temp_dir_idx(const std::string& path);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Account for the I/O of an obsolete temporary file in the statistics of the directory it
+  ///        resides in.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  temp_dir_account(const std::string& path);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain a fresh (unique) path for a temporary file in the next temporary directory.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::string
+  temp_dir_path(const std::string& post_base = "");
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain a fresh (unique) path for a temporary file in the given temporary directory.
+  ///
+  /// \pre `idx < temp_dir_count()`
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  std::string
+  temp_dir_path(const size_t idx, const std::string& post_base = "");
+}
+
+#endif // ADIAR_INTERNAL_IO_TEMP_DIR_H
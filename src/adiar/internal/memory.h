@@ -1,24 +1,209 @@
 #ifndef ADIAR_INTERNAL_MEMORY_H
 #define ADIAR_INTERNAL_MEMORY_H
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <new>
 #include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include <tpie/memory.h>
 #include <tpie/tpie.h>
 
+#include <adiar/exception.h>
+
 #include <adiar/internal/assert.h>
 
 namespace adiar::internal
 {
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether allocations are accounted for in TPIE's memory manager,
+  ///        i.e. whether TPIE is initialized.
+  //////////////////////////////////////////////////////////////////////////////
+  extern bool memory_accounting;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether the memory limit is a hard limit, i.e. whether allocations
+  ///        beyond it throw an `out_of_memory` exception.
+  //////////////////////////////////////////////////////////////////////////////
+  extern bool memory_hard_limit;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Memory held back from the data structures when the memory limit is
+  ///        a hard one. This is left for the many small allocations, e.g. of
+  ///        each decision diagram's shared pointer to its file.
+  //////////////////////////////////////////////////////////////////////////////
+  inline size_t
+  memory_reserved()
+  {
+    return memory_hard_limit ? tpie::get_memory_manager().limit() / 64u : 0u;
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief Obtain from TPIE the amount of available memory.
+  ///
+  /// \details With a hard memory limit, the `memory_reserved()` is excluded.
   //////////////////////////////////////////////////////////////////////////////
   inline size_t
   memory_available()
   {
-    return tpie::get_memory_manager().available();
+    const size_t available = tpie::get_memory_manager().available();
+    const size_t reserved  = memory_reserved();
+    return reserved < available ? available - reserved : 0u;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain from TPIE the amount of memory in use.
+  //////////////////////////////////////////////////////////////////////////////
+  inline size_t
+  memory_used()
+  {
+    return tpie::get_memory_manager().used();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Account for an allocation of the given size in TPIE's memory
+  ///        manager.
+  ///
+  /// \throws out_of_memory If the memory limit is a hard limit and the
+  ///                       allocation would exceed it.
+  //////////////////////////////////////////////////////////////////////////////
+  inline void
+  memory_register(const size_t bytes, const std::type_info& t)
+  {
+    if (memory_hard_limit && tpie::get_memory_manager().available() < bytes) {
+      throw out_of_memory();
+    }
+    tpie::get_memory_manager().register_allocation(bytes, t);
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Account for the deallocation of a prior `memory_register`.
+  //////////////////////////////////////////////////////////////////////////////
+  inline void
+  memory_unregister(const size_t bytes, const std::type_info& t)
+  {
+    // TPIE's memory manager is gone after `adiar_deinit()`.
+    if (!memory_accounting) { return; }
+    tpie::get_memory_manager().register_deallocation(bytes, t);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Allocator that accounts for its memory in TPIE's memory manager.
+  ///
+  /// \details Whether the memory is accounted for is decided when the allocator
+  ///          is created. This way, an object allocated before `adiar_init()`
+  ///          is also not unaccounted for afterwards.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  class memory_allocator
+  {
+    template <typename U>
+    friend class memory_allocator;
+
+  public:
+    using value_type = T;
+
+  private:
+    bool _accounted;
+
+  public:
+    memory_allocator() noexcept
+      : _accounted(memory_accounting)
+    {}
+
+    template <typename U>
+    memory_allocator(const memory_allocator<U>& o) noexcept
+      : _accounted(o._accounted)
+    {}
+
+    T*
+    allocate(const size_t n)
+    {
+      if (_accounted) { memory_register(n * sizeof(T), typeid(T)); }
+      try {
+        return std::allocator<T>().allocate(n);
+      } catch (...) {
+        if (_accounted) { memory_unregister(n * sizeof(T), typeid(T)); }
+        throw;
+      }
+    }
+
+    void
+    deallocate(T* p, const size_t n) noexcept
+    {
+      std::allocator<T>().deallocate(p, n);
+      if (_accounted) { memory_unregister(n * sizeof(T), typeid(T)); }
+    }
+
+    template <typename U>
+    bool
+    operator==(const memory_allocator<U>& o) const noexcept
+    {
+      return this->_accounted == o._accounted;
+    }
+
+    template <typename U>
+    bool
+    operator!=(const memory_allocator<U>& o) const noexcept
+    {
+      return !(*this == o);
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A `std::vector` whose memory is accounted for in TPIE's memory
+  ///        manager.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  using memory_vector = std::vector<T, memory_allocator<T>>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A `std::map` whose memory is accounted for in TPIE's memory
+  ///        manager.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Key, typename T, typename Compare = std::less<Key>>
+  using memory_map = std::map<Key, T, Compare, memory_allocator<std::pair<const Key, T>>>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Deleter that also undoes the accounting of an object's memory in
+  ///          TPIE's memory manager.
+  ///
+  /// \details The size and type of the object is stored, such that a pointer
+  ///          to a derived object can be deleted through a pointer to its base.
+  //////////////////////////////////////////////////////////////////////////////
+  class memory_deleter
+  {
+  private:
+    size_t _bytes                = 0u;
+    const std::type_info* _type = nullptr;
+
+  public:
+    constexpr memory_deleter() noexcept = default;
+
+    memory_deleter(const size_t bytes, const std::type_info& t) noexcept
+      : _bytes(bytes)
+      , _type(&t)
+    {}
+
+    /// \brief Conversion from a default deleter (for an unaccounted object).
+    template <typename T>
+    memory_deleter(const std::default_delete<T>&) noexcept
+    {}
+
+    template <typename T>
+    void
+    operator()(T* p) const
+    {
+      delete p;
+      if (this->_type) { memory_unregister(this->_bytes, *this->_type); }
+    }
+  };
+}
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief Enum to specify implementation of auxiliary data structures.
   ///
@@ -26,11 +211,15 @@ namespace adiar::internal
   ///          data structure: (1) that handles enormous amounts of data by
   ///          using the external memory (the disk) and (2) an implementation
   ///          that is much faster but is limited to internal memory (the RAM).
+  ///
+  ///          The `Hybrid` variant starts out with (2) and only spills its
+  ///          content into (1) when it outgrows the memory it was given.
   //////////////////////////////////////////////////////////////////////////////
   enum class memory_mode
   {
     Internal,
-    External
+    External,
+    Hybrid
   };
 }
 
@@ -38,10 +227,9 @@ namespace adiar
 {
   // TODO: add std::move(...) alias
 
-  // TODO: use TPIE allocation for `make_unique` and `make_shared`. This way we
-  //       also account for the memory usage of each BDD.
-
-  // Based on <tpie/memory.h>
+  // Based on <tpie/memory.h>. Both `make_unique` and `make_shared` account for
+  // their memory in TPIE's memory manager. This way, also the memory usage of
+  // each BDD is within the limit given to `adiar_init`.
 
   //////////////////////////////////////////////////////////////////////////////
   /// \brief Shared ownership of an object on the heap. This *smart pointer*
@@ -58,7 +246,7 @@ namespace adiar
   inline shared_ptr<T>
   make_shared(TT&&... tt)
   {
-    return std::make_shared<T>(std::forward<TT>(tt)...);
+    return std::allocate_shared<T>(internal::memory_allocator<T>(), std::forward<TT>(tt)...);
   }
 
   //////////////////////////////////////////////////////////////////////////////
@@ -67,7 +255,7 @@ namespace adiar
   ///        no need to do reference counting).
   //////////////////////////////////////////////////////////////////////////////
   template <typename T>
-  using unique_ptr = std::unique_ptr<T>;
+  using unique_ptr = std::unique_ptr<T, internal::memory_deleter>;
 
   //////////////////////////////////////////////////////////////////////////////
   /// \brief Creates a new object on the heap with unique ownership.
@@ -76,7 +264,16 @@ namespace adiar
   inline unique_ptr<T>
   make_unique(TT&&... tt)
   {
-    return std::make_unique<T>(std::forward<TT>(tt)...);
+    if (!internal::memory_accounting) { return unique_ptr<T>(new T(std::forward<TT>(tt)...)); }
+
+    internal::memory_register(sizeof(T), typeid(T));
+    try {
+      return unique_ptr<T>(new T(std::forward<TT>(tt)...),
+                           internal::memory_deleter(sizeof(T), typeid(T)));
+    } catch (...) {
+      internal::memory_unregister(sizeof(T), typeid(T));
+      throw;
+    }
   }
 }
 
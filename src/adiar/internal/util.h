@@ -1,6 +1,9 @@
 #ifndef ADIAR_INTERNAL_UTIL_H
 #define ADIAR_INTERNAL_UTIL_H
 
+#include <algorithm>
+#include <vector>
+
 #include <adiar/functional.h>
 #include <adiar/type_traits.h>
 #include <adiar/types.h>
@@ -16,6 +19,7 @@
 #include <adiar/internal/io/levelized_ifstream.h>
 #include <adiar/internal/io/node_ifstream.h>
 #include <adiar/internal/io/shared_file_ptr.h>
+#include <adiar/internal/memory.h>
 
 namespace adiar::internal
 {
@@ -95,6 +99,24 @@ namespace adiar::internal
     return false;
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the union of the levels of multiple diagrams (in ascending order).
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename DD, typename Allocator>
+  memory_vector<typename DD::label_type>
+  union_of_levels(const std::vector<DD, Allocator>& ds)
+  {
+    memory_vector<typename DD::label_type> res;
+    for (const DD& d : ds) {
+      level_info_ifstream<> in_meta(d);
+      while (in_meta.can_pull()) { res.push_back(in_meta.pull().level()); }
+    }
+
+    std::sort(res.begin(), res.end());
+    res.erase(std::unique(res.begin(), res.end()), res.end());
+    return res;
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Handles all requests with the desired `target` with the given `Handler(...)`.
   ///
@@ -135,6 +157,30 @@ namespace adiar::internal
     request_foreach(pq_2, target, handler);
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Handles all requests with the desired `target` of the given `output` with the given
+  ///        `Handler(...)`.
+  ///
+  /// \details Variant of `request_foreach` for requests that carry `with_output_and_parent`.
+  ///
+  /// \param pq      Priority queue to take requests from.
+  /// \param handler Handler function object to call for each request
+  /// \param target  Target to pull for
+  /// \param output  Output to pull for
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename PriorityQueue, typename Handler>
+  void
+  request_foreach_output(PriorityQueue& pq,
+                         const typename PriorityQueue::value_type::target_t& target,
+                         const size_t output,
+                         const Handler& handler)
+  {
+    while (pq.has_top() && pq.top().target == target && pq.top().data.output == output) {
+      handler(pq.top());
+      pq.pop();
+    }
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Obtain the semi-transposition of a decision diagram.
   ///
@@ -15,9 +15,12 @@
 #include <adiar/internal/algorithms/reduce.h>
 #include <adiar/internal/algorithms/replace.h>
 #include <adiar/internal/algorithms/select.h>
+#include <adiar/internal/data_structures/buffer_pool.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
 #include <adiar/internal/io/arc_file.h>
+#include <adiar/internal/io/file_pool.h>
 #include <adiar/internal/io/node_file.h>
+#include <adiar/internal/io/temp_dir.h>
 
 namespace adiar
 {
@@ -35,9 +38,12 @@ namespace adiar
     return { // i/o
              internal::stats_arc_file,
              internal::stats_node_file,
+             internal::stats_file_pool,
+             internal::stats_temp_dirs,
 
              // data structures
              internal::stats_levelized_priority_queue,
+             internal::stats_buffer_pool,
 
              // top-down sweeps
              internal::stats_count,
@@ -65,9 +71,12 @@ namespace adiar
     // i/o
     internal::stats_arc_file  = {};
     internal::stats_node_file = {};
+    internal::stats_file_pool = {};
+    internal::stats_temp_dirs = {};
 
     // data structures
     internal::stats_levelized_priority_queue = {};
+    internal::stats_buffer_pool              = {};
 
     // top-down sweeps
     internal::stats_count    = {};
@@ -193,6 +202,87 @@ namespace adiar
     indent_level--;
   }
 
+  void
+  __printstat_file_pool(std::ostream& o)
+  {
+    o << indent << bold_on << "Temporary File Pool" << bold_off << endl;
+
+    indent_level++;
+
+    const uintwide total_acquires =
+      internal::stats_file_pool.acquire_hit + internal::stats_file_pool.acquire_miss;
+
+    const uintwide total_releases =
+      internal::stats_file_pool.release_recycle + internal::stats_file_pool.release_discard;
+
+    if (total_acquires + total_releases == 0u) {
+      o << indent << "Not used" << endl;
+      indent_level--;
+      return;
+    }
+
+    o << indent << bold_on << label << "acquire(...)" << bold_off << total_acquires << endl;
+
+    indent_level++;
+    o << indent << label << "reused" << internal::stats_file_pool.acquire_hit << " = "
+      << internal::percent_frac(internal::stats_file_pool.acquire_hit, total_acquires) << percent
+      << endl;
+    o << indent << label << "created" << internal::stats_file_pool.acquire_miss << " = "
+      << internal::percent_frac(internal::stats_file_pool.acquire_miss, total_acquires) << percent
+      << endl;
+    indent_level--;
+
+    o << indent << bold_on << label << "release(...)" << bold_off << total_releases << endl;
+
+    indent_level++;
+    o << indent << label << "recycled" << internal::stats_file_pool.release_recycle << " = "
+      << internal::percent_frac(internal::stats_file_pool.release_recycle, total_releases)
+      << percent << endl;
+    o << indent << label << "deleted" << internal::stats_file_pool.release_discard << " = "
+      << internal::percent_frac(internal::stats_file_pool.release_discard, total_releases)
+      << percent << endl;
+    indent_level--;
+
+    indent_level--;
+  }
+
+  void
+  __printstat_temp_dirs(std::ostream& o)
+  {
+    o << indent << bold_on << "Temporary Directories" << bold_off << endl;
+
+    indent_level++;
+
+    uintwide total_files = 0u;
+    uintwide total_bytes = 0u;
+    for (const auto& d : internal::stats_temp_dirs.dirs) {
+      total_files += d.files;
+      total_bytes += d.bytes;
+    }
+
+    if (total_files == 0u) {
+      o << indent << "No files" << endl;
+      indent_level--;
+      return;
+    }
+
+    for (size_t idx = 0u; idx < statistics::temp_dirs_t::max_dirs; ++idx) {
+      const auto& d = internal::stats_temp_dirs.dirs[idx];
+      if (d.files == 0u) { continue; }
+
+      o << indent << bold_on << "[" << idx << "]" << bold_off << endl;
+
+      indent_level++;
+      o << indent << label << "files" << d.files << " = "
+        << internal::percent_frac(d.files, total_files) << percent << endl;
+      o << indent << label << "bytes" << d.bytes << " = "
+        << internal::percent_frac(d.bytes, total_bytes) << percent << endl;
+      indent_level--;
+    }
+
+    indent_level--;
+  }
+
   void
   __printstat_lpq(std::ostream& o, const statistics::levelized_priority_queue_t& stats)
   {
@@ -231,7 +321,61 @@ namespace adiar
       << stats.sum_predicted_max_size << " = "
       << internal::percent_frac(stats.sum_actual_max_size, stats.sum_predicted_max_size) << percent
       << endl;
-    indent_level -= 2;
+    indent_level--;
+
+    o << indent << endl;
+
+    o << indent << bold_on << label << "bucket reallocations" << bold_off
+      << stats.bucket_reallocations << endl;
+    o << indent << bold_on << label << "external buckets" << bold_off << stats.external_buckets
+      << endl;
+    o << indent << bold_on << label << "peak memory (bytes)" << bold_off << stats.peak_memory
+      << endl;
+    indent_level--;
+  }
+
+  void
+  __printstat_buffer_pool(std::ostream& o)
+  {
+    o << indent << bold_on << "Internal Buffer Pool" << bold_off << endl;
+
+    indent_level++;
+
+    const uintwide total_acquires =
+      internal::stats_buffer_pool.acquire_hit + internal::stats_buffer_pool.acquire_miss;
+
+    const uintwide total_releases =
+      internal::stats_buffer_pool.release_recycle + internal::stats_buffer_pool.release_discard;
+
+    if (total_acquires + total_releases == 0u) {
+      o << indent << "Not used" << endl;
+      indent_level--;
+      return;
+    }
+
+    o << indent << bold_on << label << "acquire(...)" << bold_off << total_acquires << endl;
+
+    indent_level++;
+    o << indent << label << "reused" << internal::stats_buffer_pool.acquire_hit << " = "
+      << internal::percent_frac(internal::stats_buffer_pool.acquire_hit, total_acquires)
+      << percent << endl;
+    o << indent << label << "allocated" << internal::stats_buffer_pool.acquire_miss << " = "
+      << internal::percent_frac(internal::stats_buffer_pool.acquire_miss, total_acquires)
+      << percent << endl;
+    indent_level--;
+
+    o << indent << bold_on << label << "release(...)" << bold_off << total_releases << endl;
+
+    indent_level++;
+    o << indent << label << "recycled" << internal::stats_buffer_pool.release_recycle << " = "
+      << internal::percent_frac(internal::stats_buffer_pool.release_recycle, total_releases)
+      << percent << endl;
+    o << indent << label << "freed" << internal::stats_buffer_pool.release_discard << " = "
+      << internal::percent_frac(internal::stats_buffer_pool.release_discard, total_releases)
+      << percent << endl;
+    indent_level--;
+
+    indent_level--;
   }
 
   void
@@ -247,6 +391,12 @@ namespace adiar
     o << indent << label << "external memory" << stats.lpq.external << " = "
       << internal::percent_frac(stats.lpq.external, total_lpqs) << percent << endl;
 
+    o << indent << label << "  low memory" << stats.lpq.low_memory << " = "
+      << internal::percent_frac(stats.lpq.low_memory, stats.lpq.external) << percent << endl;
+
+    o << indent << label << "hybrid memory" << stats.lpq.hybrid << " = "
+      << internal::percent_frac(stats.lpq.hybrid, total_lpqs) << percent << endl;
+
     o << indent << label << "internal memory" << total_internal_lpqs << " = "
       << internal::percent_frac(total_internal_lpqs, total_lpqs) << percent << endl;
 
@@ -621,6 +771,11 @@ namespace adiar
 
       o << indent << bold_on << label << "case [singleton sweep]" << bold_off
         << internal::stats_quantify.singleton_sweeps << endl;
+
+      indent_level++;
+      o << indent << label << "nested sweep without enough memory"
+        << internal::stats_quantify.low_memory << endl;
+      indent_level--;
     }
 
     {
@@ -678,6 +833,48 @@ namespace adiar
 
       indent_level -= 2;
     }
+
+    {
+      const statistics::quantify_t::automatic_t& stats_auto = internal::stats_quantify.automatic;
+
+      const uintwide total_decisions = stats_auto.singleton + stats_auto.nested_pruning
+        + stats_auto.nested_singleton + stats_auto.nested_unpredicted;
+
+      o << indent << endl;
+
+      o << indent << bold_on << label << "automatic strategy" << bold_off << total_decisions
+        << endl;
+
+      indent_level++;
+
+      if (total_decisions == 0u) {
+        o << indent << "Not used" << endl;
+        indent_level -= 2;
+        return;
+      }
+
+      o << indent << label << "singleton sweeps" << stats_auto.singleton << " = "
+        << internal::percent_frac(stats_auto.singleton, total_decisions) << percent << endl;
+
+      o << indent << label << "nested (pruning)" << stats_auto.nested_pruning << " = "
+        << internal::percent_frac(stats_auto.nested_pruning, total_decisions) << percent << endl;
+
+      o << indent << label << "nested (singleton)" << stats_auto.nested_singleton << " = "
+        << internal::percent_frac(stats_auto.nested_singleton, total_decisions) << percent << endl;
+
+      o << indent << label << "nested (unpredicted)" << stats_auto.nested_unpredicted << " = "
+        << internal::percent_frac(stats_auto.nested_unpredicted, total_decisions) << percent
+        << endl;
+
+      o << indent << endl;
+
+      o << indent << label << "predicted cost" << stats_auto.predicted_cost << endl;
+      o << indent << label << "actual cost" << stats_auto.actual_cost << " = "
+        << internal::percent_frac(stats_auto.actual_cost, stats_auto.predicted_cost) << percent
+        << endl;
+
+      indent_level--;
+    }
     indent_level--;
   }
 
@@ -1072,11 +1269,20 @@ namespace adiar
     __printstat_node_file(o);
     o << endl;
 
+    __printstat_file_pool(o);
+    o << endl;
+
+    __printstat_temp_dirs(o);
+    o << endl;
+
     o << bold_on << "--== Data Structures ==--" << bold_off << endl << endl;
 
     __printstat_lpq(o, internal::stats_levelized_priority_queue);
     o << endl;
 
+    __printstat_buffer_pool(o);
+    o << endl;
+
     o << bold_on << "--== Nested Sweeping Framework ==--" << bold_off << endl << endl;
 
     __printstat_nested_sweeping(o);
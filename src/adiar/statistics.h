@@ -85,6 +85,70 @@ namespace adiar
     /// \copydoc node_file_t
     node_file;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Statistics on recycling of temporary files.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    struct file_pool_t
+    {
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of files created by reusing a recycled one.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide acquire_hit = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of files that had to be created anew.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide acquire_miss = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of obsolete files that have been recycled.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide release_recycle = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of obsolete files that have been deleted (the pool was full or the file was
+      ///        placed elsewhere).
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide release_discard = 0;
+    }
+    /// \copydoc file_pool_t
+    file_pool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Statistics on the usage of each temporary directory.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    struct temp_dirs_t
+    {
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Maximum number of directories with individual statistics. Any directories beyond
+      ///        this are accounted for in the last one.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      static constexpr size_t max_dirs = 8u;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Statistics for a single directory.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      struct dir_t
+      {
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Number of temporary files placed in this directory.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        uintwide files = 0;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Number of bytes written to the temporary files in this directory.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        uintwide bytes = 0;
+      };
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Statistics for each directory (in the order they were given to `adiar_init`).
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      dir_t dirs[max_dirs];
+    }
+    /// \copydoc temp_dirs_t
+    temp_dirs;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     // Data Structures
 
@@ -103,6 +167,28 @@ namespace adiar
       //////////////////////////////////////////////////////////////////////////////////////////////
       uintwide push_overflow = 0;
 
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of times a bucket was given a different amount of memory than for its
+      ///        prior level (initially, an equal share) due to the width of its new level.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide bucket_reallocations = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of times a bucket was set up in external memory right away, since the cut
+      ///        of its level predicted more elements than its memory could hold.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide external_buckets = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief   The maximum memory in use (in bytes) during any of the levelized priority queues,
+      ///          as accounted for by TPIE's memory manager.
+      ///
+      /// \details This is the memory in use by *all* of Adiar, not only by the priority queues. It
+      ///          is sampled at the start of each level and when a priority queue is destructed.
+      ///          Hence, a short-lived peak in the middle of a level is not included.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      size_t peak_memory = 0;
+
       //////////////////////////////////////////////////////////////////////////////////////////////
       /// \brief The sum over all levelized priority queue's predicted maximum size, i.e. \f$
       /// \sum_{\mathit{pq} \in \mathit{PQ}} \mathit{pq}.\mathit{predicted\_size} \f$
@@ -136,6 +222,35 @@ namespace adiar
     /// \copydoc levelized_priority_queue_t
     levelized_priority_queue;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Statistics on recycling of the internal memory buffers of sorters, priority queues,
+    ///        and level buffers.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    struct buffer_pool_t
+    {
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of buffers obtained by reusing a recycled one.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide acquire_hit = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of buffers that had to be allocated anew.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide acquire_miss = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of obsolete buffers that have been recycled.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide release_recycle = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of obsolete buffers that have been freed (the pool was full).
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide release_discard = 0;
+    }
+    /// \copydoc buffer_pool_t
+    buffer_pool;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     // Algorithms
 
@@ -164,13 +279,25 @@ namespace adiar
         ////////////////////////////////////////////////////////////////////////////////////////////
         uintwide external = 0;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Number of *bucketed hybrid* levelized priority queues, i.e. ones that start in
+        ///        internal memory and only spill to external memory if they outgrow it.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        uintwide hybrid = 0;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Number of the *external* levelized priority queues that have no buckets, since
+        ///        there was too little memory for the buckets' sorters.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        uintwide low_memory = 0;
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Total number of levelized priority queues.
         ////////////////////////////////////////////////////////////////////////////////////////////
         uintwide
         total() const
         {
-          return unbucketed + internal + external;
+          return unbucketed + internal + external + hybrid;
         }
       }
       /// \copydoc __lpq_t
@@ -231,7 +358,7 @@ namespace adiar
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Counting algorithm statistics.
     ///
-    /// \see bdd_satcount bdd_pathcount zdd_size
+    /// \see bdd_satcount bdd_pathcount bdd_wmc bdd_satsample bdd_eval_batch zdd_size
     ////////////////////////////////////////////////////////////////////////////////////////////////
     struct count_t : public __alg_base
     {
@@ -451,6 +578,12 @@ namespace adiar
       //////////////////////////////////////////////////////////////////////////////////////////////
       uintwide nested_sweeps = 0;
 
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of times Nested Sweeping was replaced by single-variable sweeps, since too
+      ///        little memory was available.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide low_memory = 0;
+
       //////////////////////////////////////////////////////////////////////////////////////////////
       /// \brief Transposition algorithms prior to nested multi-variable sweeping.
       //////////////////////////////////////////////////////////////////////////////////////////////
@@ -497,6 +630,45 @@ namespace adiar
         ////////////////////////////////////////////////////////////////////////////////////////////
         uintwide products = 0;
       } nested_policy;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Decisions made by the `exec_policy::quantify::Auto` cost model.
+      ///
+      /// \details The cost is measured in the number of nodes that are processed by all sweeps.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      struct automatic_t
+      {
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Number of times repeated single-variable sweeps were picked.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        uintwide singleton = 0;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Number of times nested sweeping after a pruning transposition was picked.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        uintwide nested_pruning = 0;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Number of times nested sweeping after a single-variable sweep was picked.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        uintwide nested_singleton = 0;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Number of times nested sweeping was picked without being able to predict any
+        ///        costs, e.g. for unreduced inputs or generators of variables.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        uintwide nested_unpredicted = 0;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Accumulated predicted cost of the picked strategies.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        uintwide predicted_cost = 0;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Accumulated actual cost of the picked strategies.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        uintwide actual_cost = 0;
+      } automatic;
     }
     /// \copydoc quantify_t
     quantify;
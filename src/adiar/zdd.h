@@ -578,6 +578,131 @@ namespace adiar
   operator-(__zdd&&, const zdd&);
   /// \endcond
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The join of two families of sets, i.e. the pairwise union of their sets.
+  ///
+  /// \details The join is computed by encoding both families as characteristic functions over
+  ///          three BDD variables per element, combining them in a product construction with the
+  ///          relation \f$ z \leftrightarrow (x \lor y) \f$, and quantifying the operands away.
+  ///
+  /// \param A
+  ///    ZDD for the left-hand-side of the join.
+  ///
+  /// \param B
+  ///    ZDD for the right-hand-side of the join.
+  ///
+  /// \returns \f$ A \sqcup B = \{ a \cup b \mid a \in A, b \in B \} \f$
+  ///
+  /// \throws invalid_argument
+  ///    If the encoding of the largest label in the support of `A` or `B` exceeds `bdd::max_label`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __zdd
+  zdd_join(const zdd& A, const zdd& B);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The join of two families of sets, i.e. the pairwise union of their sets.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __zdd
+  zdd_join(const exec_policy& ep, const zdd& A, const zdd& B);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The meet of two families of sets, i.e. the pairwise intersection of their sets.
+  ///
+  /// \param A
+  ///    ZDD for the left-hand-side of the meet.
+  ///
+  /// \param B
+  ///    ZDD for the right-hand-side of the meet.
+  ///
+  /// \returns \f$ A \sqcap B = \{ a \cap b \mid a \in A, b \in B \} \f$
+  ///
+  /// \throws invalid_argument
+  ///    If the encoding of the largest label in the support of `A` or `B` exceeds `bdd::max_label`.
+  ///
+  /// \see zdd_join
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __zdd
+  zdd_meet(const zdd& A, const zdd& B);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The meet of two families of sets, i.e. the pairwise intersection of their sets.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __zdd
+  zdd_meet(const exec_policy& ep, const zdd& A, const zdd& B);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The (weak) quotient of dividing one family of sets by another.
+  ///
+  /// \details The quotient is the largest family \f$ Q \f$ such that \f$ B \sqcup Q \subseteq A \f$
+  ///          where each set of \f$ Q \f$ is disjoint from every set of \f$ B \f$. Division by the
+  ///          empty family is defined to be the empty family.
+  ///
+  /// \param A
+  ///    ZDD for the dividend.
+  ///
+  /// \param B
+  ///    ZDD for the divisor.
+  ///
+  /// \returns \f$ A / B = \{ c \mid \forall b \in B : c \cap b = \emptyset \land c \cup b \in A \}
+  ///          \f$
+  ///
+  /// \throws invalid_argument
+  ///    If the encoding of the largest label in the support of `A` or `B` exceeds `bdd::max_label`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __zdd
+  zdd_quotient(const zdd& A, const zdd& B);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The (weak) quotient of dividing one family of sets by another.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __zdd
+  zdd_quotient(const exec_policy& ep, const zdd& A, const zdd& B);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The remainder of dividing one family of sets by another.
+  ///
+  /// \param A
+  ///    ZDD for the dividend.
+  ///
+  /// \param B
+  ///    ZDD for the divisor.
+  ///
+  /// \returns \f$ A \bmod B = A \setminus (B \sqcup (A / B)) \f$
+  ///
+  /// \see zdd_quotient
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __zdd
+  zdd_remainder(const zdd& A, const zdd& B);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The remainder of dividing one family of sets by another.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __zdd
+  zdd_remainder(const exec_policy& ep, const zdd& A, const zdd& B);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The subfamily of sets with at most a given number of elements.
+  ///
+  /// \details Intersects the family with a ZDD that counts the number of elements taken over the
+  ///          support of `A`, i.e. it only needs a single product construction.
+  ///
+  /// \param A
+  ///    Family of sets.
+  ///
+  /// \param k
+  ///    Maximum size of each set.
+  ///
+  /// \returns \f$ \{ a \in A \mid |a| \leq k \} \f$
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __zdd
+  zdd_atmost(const zdd& A, size_t k);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The subfamily of sets with at most a given number of elements.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __zdd
+  zdd_atmost(const exec_policy& ep, const zdd& A, size_t k);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief The symmetric difference between each set in the family and the given set of variables.
   ///
@@ -1565,6 +1690,12 @@ namespace adiar
   zdd
   zdd_minelem(const zdd& A);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Retrieves the lexicographically smallest set a in A.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  zdd
+  zdd_minelem(const exec_policy& ep, const zdd& A);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief    Retrieves the lexicographically smallest set a in A.
   ///
@@ -1613,6 +1744,12 @@ namespace adiar
   zdd
   zdd_maxelem(const zdd& A);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Retrieves the lexicographically largest set a in A.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  zdd
+  zdd_maxelem(const exec_policy& ep, const zdd& A);
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Retrieves the lexicographically largest set a in A.
   ///
@@ -1648,6 +1785,34 @@ namespace adiar
     return iter;
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Enumerate all sets within a family.
+  ///
+  /// \details The paths to the true terminal are enumerated with a single depth-first traversal.
+  ///          Each such path is exactly one set in the family. The sets are provided in
+  ///          lexicographical order (of their bit-vectors).
+  ///
+  /// \param A
+  ///    ZDD of interest.
+  ///
+  /// \param c
+  ///    Consumer that is called once per set with a generator of its elements in ascending order.
+  ///
+  /// \remark The generator is only valid until `c` returns.
+  ///
+  /// \remark If they fit, the nodes of `A` are loaded into internal memory. Otherwise, they are
+  ///         streamed from disk, where jumping back up to a node's high child may require the
+  ///         nodes to be read again from the start.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  zdd_elements(const zdd& A, const consumer<generator<zdd::label_type>>& c);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Enumerate all sets within a family.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  zdd_elements(const exec_policy& ep, const zdd& A, const consumer<generator<zdd::label_type>>& c);
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////////////////////////
 
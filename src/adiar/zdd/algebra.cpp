@@ -0,0 +1,292 @@
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <adiar/bdd.h>
+#include <adiar/exception.h>
+#include <adiar/zdd.h>
+#include <adiar/zdd/zdd_policy.h>
+
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/io/levelized_file.h>
+#include <adiar/internal/io/node_ofstream.h>
+#include <adiar/internal/unreachable.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Set algebra via characteristic functions
+  //
+  // Each element `d` of the (joint) support of both families is encoded with three BDD variables:
+  // the result `z = 3d`, the left operand `x = 3d+1`, and the right operand `y = 3d+2`. The sets of
+  // each operand are then characteristic functions over their variables, that are combined with a
+  // relation that is built directly as a chain of small per-element gadgets. Existential (and
+  // universal) quantification of the operands then leaves the characteristic function of the
+  // result over the `z` variables.
+
+  /// \brief Children of the `x` nodes of a gadget.
+  enum class algebra_child : char
+  {
+    /// Gadget of next element (or the true terminal)
+    Next,
+    /// False terminal
+    Bot,
+    /// The `y` node that requires `y = 0`.
+    Y0,
+    /// The `y` node that requires `y = 1`.
+    Y1,
+  };
+
+  /// \brief Children (low, high) of the `x` node reached for `z = 0` and `z = 1`, respectively.
+  using algebra_gadget = algebra_child[2][2];
+
+  // z <-> x \/ y
+  constexpr algebra_gadget join_gadget = {
+    { algebra_child::Y0, algebra_child::Bot },
+    { algebra_child::Y1, algebra_child::Next }
+  };
+
+  // z <-> x /\ y
+  constexpr algebra_gadget meet_gadget = {
+    { algebra_child::Next, algebra_child::Y0 },
+    { algebra_child::Bot, algebra_child::Y1 }
+  };
+
+  // x <-> z \/ y where z /\ y is false
+  constexpr algebra_gadget quotient_gadget = {
+    { algebra_child::Y0, algebra_child::Y1 },
+    { algebra_child::Bot, algebra_child::Y0 }
+  };
+
+  /// \brief The joint support of both families in ascending order.
+  std::vector<zdd::label_type>
+  __zdd_algebra_dom(const zdd& A, const zdd& B)
+  {
+    std::vector<zdd::label_type> dom;
+    zdd_support(A, std::back_inserter(dom));
+    zdd_support(B, std::back_inserter(dom));
+
+    std::sort(dom.begin(), dom.end());
+    dom.erase(std::unique(dom.begin(), dom.end()), dom.end());
+
+    if (!dom.empty() && dom.back() > (bdd::max_label - 2u) / 3u) {
+      throw invalid_argument("Labels are too large to be encoded as BDD variables");
+    }
+    return dom;
+  }
+
+  /// \brief Characteristic function of `A` over the variables `3d + offset`.
+  bdd
+  __zdd_algebra_encode(const exec_policy& ep,
+                       const zdd& A,
+                       const std::vector<zdd::label_type>& dom,
+                       const bdd::label_type offset)
+  {
+    return bdd_replace(ep,
+                       bdd_from(ep, A, make_generator(dom.begin(), dom.end())),
+                       [offset](const bdd::label_type x) { return 3u * x + offset; },
+                       replace_type::Monotone);
+  }
+
+  /// \brief Family of sets for a characteristic function over the `z` variables.
+  __zdd
+  __zdd_algebra_decode(const exec_policy& ep,
+                       const bdd& f,
+                       const std::vector<zdd::label_type>& dom)
+  {
+    const bdd f_dom = bdd_replace(
+      ep, f, [](const bdd::label_type x) { return x / 3u; }, replace_type::Monotone);
+
+    return zdd_from(ep, f_dom, make_generator(dom.begin(), dom.end()));
+  }
+
+  /// \brief Relation between `z`, `x`, and `y` for each element in the domain.
+  bdd
+  __zdd_algebra_relation(const std::vector<zdd::label_type>& dom, const algebra_gadget& g)
+  {
+    internal::shared_levelized_file<bdd::node_type> nf;
+    {
+      internal::node_ofstream nw(nf);
+
+      bdd::pointer_type next(true);
+      for (auto it = dom.rbegin(); it != dom.rend(); ++it) {
+        const bdd::label_type z = 3u * (*it);
+        const bdd::label_type x = z + 1u;
+        const bdd::label_type y = z + 2u;
+
+        const bdd::node_type y1(y, bdd::max_id, bdd::pointer_type(false), next);
+        const bdd::node_type y0(y, bdd::max_id - 1u, next, bdd::pointer_type(false));
+        nw << y1 << y0;
+
+        const auto child = [&](const algebra_child c) -> bdd::pointer_type {
+          switch (c) {
+          case algebra_child::Next: return next;
+          case algebra_child::Bot: return bdd::pointer_type(false);
+          case algebra_child::Y0: return y0.uid();
+          case algebra_child::Y1: return y1.uid();
+          }
+          adiar_unreachable(); // LCOV_EXCL_LINE
+        };
+
+        const bdd::node_type x1(x, bdd::max_id, child(g[1][0]), child(g[1][1]));
+        const bdd::node_type x0(x, bdd::max_id - 1u, child(g[0][0]), child(g[0][1]));
+        nw << x1 << x0;
+
+        const bdd::node_type r(z, bdd::max_id, x0.uid(), x1.uid());
+        nw << r;
+
+        next = r.uid();
+      }
+    }
+    return nf;
+  }
+
+  /// \brief Pairwise combination of all sets in `A` and `B` with the given relation.
+  __zdd
+  __zdd_algebra_pairwise(const exec_policy& ep,
+                         const zdd& A,
+                         const zdd& B,
+                         const algebra_gadget& g)
+  {
+    const std::vector<zdd::label_type> dom = __zdd_algebra_dom(A, B);
+
+    const bdd a = __zdd_algebra_encode(ep, A, dom, 1u);
+    const bdd b = __zdd_algebra_encode(ep, B, dom, 2u);
+    const bdd r = __zdd_algebra_relation(dom, g);
+
+    const bdd res = bdd_exists(
+      ep, bdd_and(ep, bdd_and(ep, a, r), b), [](const bdd::label_type x) { return x % 3u != 0u; });
+
+    return __zdd_algebra_decode(ep, res, dom);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __zdd
+  zdd_join(const exec_policy& ep, const zdd& A, const zdd& B)
+  {
+    if (zdd_isempty(A) || zdd_isempty(B)) { return zdd_empty(); }
+    if (zdd_isnull(A)) { return B; }
+    if (zdd_isnull(B)) { return A; }
+
+    return __zdd_algebra_pairwise(ep, A, B, join_gadget);
+  }
+
+  __zdd
+  zdd_join(const zdd& A, const zdd& B)
+  {
+    return zdd_join(exec_policy(), A, B);
+  }
+
+  __zdd
+  zdd_meet(const exec_policy& ep, const zdd& A, const zdd& B)
+  {
+    if (zdd_isempty(A) || zdd_isempty(B)) { return zdd_empty(); }
+    if (zdd_isnull(A) || zdd_isnull(B)) { return zdd_null(); }
+
+    return __zdd_algebra_pairwise(ep, A, B, meet_gadget);
+  }
+
+  __zdd
+  zdd_meet(const zdd& A, const zdd& B)
+  {
+    return zdd_meet(exec_policy(), A, B);
+  }
+
+  __zdd
+  zdd_quotient(const exec_policy& ep, const zdd& A, const zdd& B)
+  {
+    if (zdd_isempty(A) || zdd_isempty(B)) { return zdd_empty(); }
+    if (zdd_isnull(B)) { return A; }
+
+    const std::vector<zdd::label_type> dom = __zdd_algebra_dom(A, B);
+
+    const bdd a = __zdd_algebra_encode(ep, A, dom, 1u);
+    const bdd b = __zdd_algebra_encode(ep, B, dom, 2u);
+    const bdd r = __zdd_algebra_relation(dom, quotient_gadget);
+
+    // T(z,y) = { (c,b) | c \/ b in A and c /\ b is empty }
+    const bdd t = bdd_exists(ep, bdd_and(ep, a, r), [](const bdd::label_type x) {
+      return x % 3u == 1u;
+    });
+
+    // Q(z) = { c | for all b in B : T(c,b) }
+    const bdd q = bdd_forall(ep, bdd_imp(ep, b, t), [](const bdd::label_type x) {
+      return x % 3u == 2u;
+    });
+
+    return __zdd_algebra_decode(ep, q, dom);
+  }
+
+  __zdd
+  zdd_quotient(const zdd& A, const zdd& B)
+  {
+    return zdd_quotient(exec_policy(), A, B);
+  }
+
+  __zdd
+  zdd_remainder(const exec_policy& ep, const zdd& A, const zdd& B)
+  {
+    return zdd_diff(ep, A, zdd_join(ep, B, zdd_quotient(ep, A, B)));
+  }
+
+  __zdd
+  zdd_remainder(const zdd& A, const zdd& B)
+  {
+    return zdd_remainder(exec_policy(), A, B);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Cardinality restriction
+  //
+  // The family of all sets within the support of `A` with at most `k` elements is built directly
+  // bottom-up. At the ith level (with `r` levels remaining) there is a node for each remaining
+  // budget `max(1, k-(i-1)), ..., min(k, r)`, i.e. each budget that can be reached from the root
+  // and not yet covers all remaining levels. The node with budget `b` has `id = max_id - (b-lo)`
+  // where `lo` is the smallest budget on its level.
+
+  __zdd
+  zdd_atmost(const exec_policy& ep, const zdd& A, size_t k)
+  {
+    std::vector<zdd::label_type> dom;
+    zdd_support(A, std::back_inserter(dom));
+
+    const size_t m = dom.size();
+    if (m <= k) { return A; }
+    if (k == 0) { return zdd_intsec(ep, A, zdd_null()); }
+
+    internal::shared_levelized_file<zdd::node_type> nf;
+    {
+      internal::node_ofstream nw(nf);
+
+      // Smallest budget that can be reached at the ith level (1-indexed from the root)
+      const auto min_budget = [&k](const size_t i) -> size_t {
+        return i - 1 < k ? k - (i - 1) : 1;
+      };
+
+      for (size_t i = m; 0 < i; --i) {
+        const zdd::label_type label = dom[i - 1];
+        const size_t remaining      = m - (i - 1);
+
+        // Child at the next level with the given budget
+        const auto child = [&](const size_t budget) -> zdd::pointer_type {
+          const size_t b = std::min(budget, remaining - 1);
+          if (b == 0) { return zdd::pointer_type(true); }
+          return zdd::pointer_type(dom[i], zdd::max_id - (b - min_budget(i + 1)));
+        };
+
+        const size_t lo = min_budget(i);
+        const size_t hi = std::min(k, remaining);
+        for (size_t b = lo; b <= hi; ++b) {
+          nw << zdd::node_type(label, zdd::max_id - (b - lo), child(b), child(b - 1));
+        }
+      }
+    }
+    return zdd_intsec(ep, A, zdd(nf));
+  }
+
+  __zdd
+  zdd_atmost(const zdd& A, size_t k)
+  {
+    return zdd_atmost(exec_policy(), A, k);
+  }
+}
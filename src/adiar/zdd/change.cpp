@@ -28,10 +28,11 @@ namespace adiar
       return dd;
     }
 
+    template <typename Vector>
     static zdd
     on_terminal_input(const bool terminal_value,
                       const zdd& dd,
-                      const internal::internal_vector<zdd::label_type>& vars)
+                      const Vector& vars)
     {
       // TODO: simplify with generator function as input
       if (terminal_value) {
@@ -54,10 +54,11 @@ namespace adiar
       return dd;
     }
 
+    template <typename Vector>
     static zdd
     on_terminal_input(const bool terminal_value,
                       const zdd& /*dd*/,
-                      const internal::internal_vector<zdd::label_type>& universe)
+                      const Vector& universe)
     {
       // TODO: remove
       const generator<zdd::label_type> universe_generator =
@@ -9,6 +9,7 @@
 #include <adiar/internal/data_types/uid.h>
 #include <adiar/internal/io/file.h>
 #include <adiar/internal/io/ifstream.h>
+#include <adiar/internal/io/node_ifstream.h>
 #include <adiar/internal/io/ofstream.h>
 
 namespace adiar
@@ -76,16 +77,18 @@ namespace adiar
   }
 
   //////////////////////////////////////////////////////////////////////////////
-  template <typename Visitor>
+  template <typename Visitor, internal::memory_mode StackMode>
   class __zdd_Xelem__stack
   {
+  public:
+    using value_type = zdd::label_type;
+    using stack_type = internal::stack<StackMode, value_type>;
+
   private:
     Visitor _visitor;
 
-    // Reserve an internal memory vector (of up to 8 MiB) for the result.
-    // TODO: Abstract the stack into <adiar/internal/data_structures/stack.h>.
-    using value_type = zdd::label_type;
-    internal::stack<internal::memory_mode::Internal, value_type> _stack;
+    // Stack (of up to one element per level) for the result.
+    stack_type _stack;
 
   public:
     __zdd_Xelem__stack(size_t max_size)
@@ -123,24 +126,89 @@ namespace adiar
     }
   };
 
-  template <typename Visitor>
+  template <typename Visitor, internal::memory_mode StackMode>
   zdd
   __zdd_Xelem(const zdd& A)
   {
-    __zdd_Xelem__stack<Visitor> v(A->levels());
+    __zdd_Xelem__stack<Visitor, StackMode> v(A->levels());
     internal::traverse(A, v);
     return v.build_zdd();
   }
 
+  template <typename Visitor>
+  zdd
+  __zdd_Xelem(const exec_policy& ep, const zdd& A)
+  {
+    // Use an internal memory stack if it fits next to the input stream of the traversal.
+    const size_t aux_available_memory =
+      internal::memory_available() - internal::node_ifstream<>::memory_usage();
+
+    using internal_stack_t =
+      typename __zdd_Xelem__stack<Visitor, internal::memory_mode::Internal>::stack_type;
+
+    const bool internal_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
+    const bool external_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::External;
+
+    const size_t stack_memory = internal_stack_t::memory_usage(A->levels());
+
+    if (internal_only || (!external_only && stack_memory <= aux_available_memory)) {
+      return __zdd_Xelem<Visitor, internal::memory_mode::Internal>(A);
+    } else {
+      return __zdd_Xelem<Visitor, internal::memory_mode::External>(A);
+    }
+  }
+
+  zdd
+  zdd_minelem(const exec_policy& ep, const zdd& A)
+  {
+    return __zdd_Xelem<internal::traverse_satmin_visitor>(ep, A);
+  }
+
   zdd
   zdd_minelem(const zdd& A)
   {
-    return __zdd_Xelem<internal::traverse_satmin_visitor>(A);
+    return zdd_minelem(exec_policy(), A);
+  }
+
+  zdd
+  zdd_maxelem(const exec_policy& ep, const zdd& A)
+  {
+    return __zdd_Xelem<internal::traverse_satmax_visitor>(ep, A);
   }
 
   zdd
   zdd_maxelem(const zdd& A)
   {
-    return __zdd_Xelem<internal::traverse_satmax_visitor>(A);
+    return zdd_maxelem(exec_policy(), A);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  void
+  zdd_elements(const exec_policy& ep, const zdd& A, const consumer<generator<zdd::label_type>>& c)
+  {
+    using path_type = pair<zdd::label_type, bool>;
+
+    if (zdd_isterminal(A)) {
+      if (zdd_isnull(A)) { c([]() { return make_optional<zdd::label_type>(); }); }
+      return;
+    }
+
+    internal::traverse_paths(ep, A, [&c](const path_type* path, const size_t length) {
+      c([path, length, i = size_t(0u)]() mutable {
+        // Only the high arcs add an element to the set.
+        while (i < length && !path[i].second) { ++i; }
+
+        if (i == length) { return make_optional<zdd::label_type>(); }
+        return make_optional<zdd::label_type>(path[i++].first);
+      });
+    });
+  }
+
+  void
+  zdd_elements(const zdd& A, const consumer<generator<zdd::label_type>>& c)
+  {
+    return zdd_elements(exec_policy(), A, c);
   }
 }
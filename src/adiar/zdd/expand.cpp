@@ -28,10 +28,11 @@ namespace adiar
       return dd;
     }
 
+    template <typename Vector>
     static zdd
     on_terminal_input(const bool terminal_value,
                       const zdd& dd,
-                      const internal::internal_vector<zdd::label_type>& vars)
+                      const Vector& vars)
     {
       if (terminal_value) {
         return zdd_powerset(make_generator(vars.rbegin(), vars.rend()));
@@ -4988,5 +4988,107 @@ go_bandit([]() {
            });
       });
     });
+
+    describe("bdd_apply(const std::vector<bdd>&, const bdd&, op)", [&]() {
+      it("returns nothing for no BDDs", [&]() {
+        const std::vector<__bdd> out = bdd_apply(std::vector<bdd>(), bdd_x2, adiar::and_op);
+        AssertThat(out.size(), Is().EqualTo(0u));
+      });
+
+      it("computes x0 /\\ x2 and x1 /\\ x2 in a shared sweep", [&]() {
+        const std::vector<bdd> fs = { bdd_x0, bdd_x1 };
+
+        const std::vector<__bdd> out = bdd_apply(fs, bdd_x2, adiar::and_op);
+
+        AssertThat(out.size(), Is().EqualTo(2u));
+
+        arc_test_ifstream arcs(out.at(0));
+
+        AssertThat(arcs.can_pull_internal(), Is().True());
+        AssertThat(arcs.pull_internal(),
+                   Is().EqualTo(arc{ bdd::uid_type(0, 0), true, bdd::pointer_type(2, 0) }));
+
+        AssertThat(arcs.can_pull_internal(), Is().False());
+
+        AssertThat(arcs.can_pull_terminal(), Is().True());
+        AssertThat(arcs.pull_terminal(),
+                   Is().EqualTo(arc{ bdd::uid_type(0, 0), false, terminal_F }));
+
+        AssertThat(arcs.can_pull_terminal(), Is().True());
+        AssertThat(arcs.pull_terminal(),
+                   Is().EqualTo(arc{ bdd::uid_type(2, 0), false, terminal_F }));
+
+        AssertThat(arcs.can_pull_terminal(), Is().True());
+        AssertThat(arcs.pull_terminal(),
+                   Is().EqualTo(arc{ bdd::uid_type(2, 0), true, terminal_T }));
+
+        AssertThat(arcs.can_pull_terminal(), Is().False());
+
+        level_info_test_ifstream levels(out.at(0));
+
+        AssertThat(levels.can_pull(), Is().True());
+        AssertThat(levels.pull(), Is().EqualTo(level_info(0, 1u)));
+
+        AssertThat(levels.can_pull(), Is().True());
+        AssertThat(levels.pull(), Is().EqualTo(level_info(2, 1u)));
+
+        AssertThat(levels.can_pull(), Is().False());
+
+        AssertThat(out.at(0).get<__bdd::shared_arc_file_type>()->max_1level_cut,
+                   Is().EqualTo(1u));
+
+        level_info_test_ifstream levels_1(out.at(1));
+
+        AssertThat(levels_1.can_pull(), Is().True());
+        AssertThat(levels_1.pull(), Is().EqualTo(level_info(1, 1u)));
+
+        AssertThat(levels_1.can_pull(), Is().True());
+        AssertThat(levels_1.pull(), Is().EqualTo(level_info(2, 1u)));
+
+        AssertThat(levels_1.can_pull(), Is().False());
+      });
+
+      const std::vector<bdd> fs = {
+        bdd_F, bdd_x0, bdd_1, bdd_2, bdd_3, bdd_thin, bdd_wide, bdd_canon, bdd_indexable,
+      };
+
+      it("agrees with bdd_and(f,g) on each BDD [indexable]", [&]() {
+        std::vector<__bdd> out = bdd_apply(fs, bdd_indexable, adiar::and_op);
+
+        AssertThat(out.size(), Is().EqualTo(fs.size()));
+        for (size_t i = 0u; i < fs.size(); ++i) {
+          AssertThat(std::move(out.at(i)) == bdd_and(fs.at(i), bdd_indexable), Is().True());
+        }
+      });
+
+      it("agrees with bdd_xor(f,g) on each BDD [canonical, external memory]", [&]() {
+        const exec_policy ep = exec_policy::memory::External;
+        std::vector<__bdd> out = bdd_apply(ep, fs, bdd_canon, adiar::xor_op);
+
+        AssertThat(out.size(), Is().EqualTo(fs.size()));
+        for (size_t i = 0u; i < fs.size(); ++i) {
+          AssertThat(std::move(out.at(i)) == bdd_xor(fs.at(i), bdd_canon), Is().True());
+        }
+      });
+
+      it("agrees with bdd_or(f,g) on each BDD [unindexable]", [&]() {
+        std::vector<__bdd> out = bdd_apply(fs, bdd_unindexable, adiar::or_op);
+
+        AssertThat(out.size(), Is().EqualTo(fs.size()));
+        for (size_t i = 0u; i < fs.size(); ++i) {
+          AssertThat(std::move(out.at(i)) == bdd_or(fs.at(i), bdd_unindexable), Is().True());
+        }
+      });
+
+      it("agrees with bdd_imp(f,g) on each BDD [priority queues]", [&]() {
+        const exec_policy ep = exec_policy::access::Priority_Queue;
+        std::vector<__bdd> out = bdd_apply(ep, fs, bdd_2, adiar::imp_op);
+
+        AssertThat(out.size(), Is().EqualTo(fs.size()));
+        for (size_t i = 0u; i < fs.size(); ++i) {
+          AssertThat(std::move(out.at(i)) == bdd_imp(fs.at(i), bdd_2), Is().True());
+        }
+      });
+    });
   });
 });
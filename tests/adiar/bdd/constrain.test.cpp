@@ -0,0 +1,157 @@
+#include "../../test.h"
+
+go_bandit([]() {
+  describe("adiar/bdd/constrain.cpp", []() {
+    const bdd terminal_F = bdd_false();
+    const bdd terminal_T = bdd_true();
+
+    const bdd x0 = bdd_ithvar(0);
+    const bdd x1 = bdd_ithvar(1);
+    const bdd x2 = bdd_ithvar(2);
+    const bdd x3 = bdd_ithvar(3);
+
+    // ite(x0, x1, x2)
+    const bdd mux = (x0 & x1) | (~x0 & x2);
+
+    describe("bdd_constrain(f, c)", [&]() {
+      it("returns f for c = T", [&]() {
+        const bdd out = bdd_constrain(mux, terminal_T);
+        AssertThat(out == mux, Is().True());
+      });
+
+      it("returns F for c = F", [&]() {
+        const bdd out = bdd_constrain(mux, terminal_F);
+        AssertThat(out == terminal_F, Is().True());
+      });
+
+      it("returns f for terminal f", [&]() {
+        AssertThat(bdd_constrain(terminal_T, x0 | x1) == terminal_T, Is().True());
+        AssertThat(bdd_constrain(terminal_F, x0 | x1) == terminal_F, Is().True());
+      });
+
+      it("returns T for f = c", [&]() {
+        const bdd out = bdd_constrain(mux, mux);
+        AssertThat(out == terminal_T, Is().True());
+      });
+
+      it("returns F for f = ~c", [&]() {
+        const bdd out = bdd_constrain(mux, ~mux);
+        AssertThat(out == terminal_F, Is().True());
+      });
+
+      it("cofactors x0 & x1 with x0", [&]() {
+        const bdd out = bdd_constrain(x0 & x1, x0);
+        AssertThat(out == x1, Is().True());
+      });
+
+      it("cofactors x0 | x1 with ~x0", [&]() {
+        const bdd out = bdd_constrain(x0 | x1, ~x0);
+        AssertThat(out == x1, Is().True());
+      });
+
+      it("skips all levels of c down to a pair of terminals", [&]() {
+        const bdd out = bdd_constrain(x1, x0 & x1);
+        AssertThat(out == terminal_T, Is().True());
+      });
+
+      it("may introduce variables of c [x1 & x2, x0 | x2]", [&]() {
+        const bdd out = bdd_constrain(x1 & x2, x0 | x2);
+        AssertThat(out == ((x0 & x1 & x2) | (~x0 & x1)), Is().True());
+      });
+
+      it("splits c on levels f skips [ite(x0,x1,x2), x0 | x1 | x2]", [&]() {
+        const bdd out = bdd_constrain(mux, x0 | x1 | x2);
+        AssertThat(out == ((x0 & x1) | (~x0 & (~x1 | x2))), Is().True());
+      });
+
+      it("agrees with f on c [Priority Queue]", [&]() {
+        const exec_policy ep = exec_policy::access::Priority_Queue;
+
+        const bdd f = (x0 ^ x2) | (x1 & x3);
+        const bdd c = (x0 | x1) & (x2 | ~x3);
+
+        const bdd out = bdd_constrain(ep, f, c);
+        AssertThat((out & c) == (f & c), Is().True());
+      });
+
+      it("agrees with f on c [Random Access]", [&]() {
+        const exec_policy ep = exec_policy::access::Random_Access;
+
+        const bdd f = (x0 ^ x2) | (x1 & x3);
+        const bdd c = (x0 | x1) & (x2 | ~x3);
+
+        const bdd out = bdd_constrain(ep, f, c);
+        AssertThat((out & c) == (f & c), Is().True());
+      });
+
+      it("agrees with f on c for narrow f [Random Access]", [&]() {
+        const exec_policy ep = exec_policy::access::Random_Access;
+
+        // The narrower 'x1 | x3' is used for random access, i.e. the arguments are flipped.
+        const bdd f = x1 | x3;
+        const bdd c = (x0 ^ x1) | (x2 ^ x3);
+
+        const bdd out = bdd_constrain(ep, f, c);
+        AssertThat((out & c) == (f & c), Is().True());
+      });
+    });
+
+    describe("bdd_simplify(f, care)", [&]() {
+      it("returns f for care = T", [&]() {
+        const bdd out = bdd_simplify(mux, terminal_T);
+        AssertThat(out == mux, Is().True());
+      });
+
+      it("returns F for care = F", [&]() {
+        const bdd out = bdd_simplify(mux, terminal_F);
+        AssertThat(out == terminal_F, Is().True());
+      });
+
+      it("returns T for f = care", [&]() {
+        const bdd out = bdd_simplify(mux, mux);
+        AssertThat(out == terminal_T, Is().True());
+      });
+
+      it("cofactors x0 & x1 with x0", [&]() {
+        const bdd out = bdd_simplify(x0 & x1, x0);
+        AssertThat(out == x1, Is().True());
+      });
+
+      it("does not introduce variables of care [x1 & x2, x0 | x2]", [&]() {
+        const bdd out = bdd_simplify(x1 & x2, x0 | x2);
+        AssertThat(out == (x1 & x2), Is().True());
+      });
+
+      it("does not split care on levels f skips [ite(x0,x1,x2), x0 | x1 | x2]", [&]() {
+        const bdd out = bdd_simplify(mux, x0 | x1 | x2);
+        AssertThat(out == mux, Is().True());
+      });
+
+      it("quantifies variables of care not in f [x1, x0 & x1]", [&]() {
+        const bdd out = bdd_simplify(x1, x0 & x1);
+        AssertThat(out == terminal_T, Is().True());
+      });
+
+      it("agrees with f on care [Priority Queue]", [&]() {
+        const exec_policy ep = exec_policy::access::Priority_Queue;
+
+        const bdd f    = (x0 ^ x2) | (x1 & x3);
+        const bdd care = (x0 | x1) & (x2 | ~x3);
+
+        const bdd out = bdd_simplify(ep, f, care);
+        AssertThat((out & care) == (f & care), Is().True());
+      });
+
+      it("agrees with f on care [Random Access]", [&]() {
+        const exec_policy ep = exec_policy::access::Random_Access;
+
+        const bdd f    = x1 | x3;
+        const bdd care = (x0 ^ x1) | (x2 ^ x3);
+
+        const bdd out = bdd_simplify(ep, f, care);
+        AssertThat((out & care) == (f & care), Is().True());
+        AssertThat(bdd_varcount(out) <= bdd_varcount(f), Is().True());
+      });
+    });
+  });
+});
@@ -1,4 +1,5 @@
 #include "../../test.h"
+#include <cmath>
 
 go_bandit([]() {
   describe("adiar/bdd/count.cpp", []() {
@@ -273,6 +274,209 @@ go_bandit([]() {
       });
     });
 
+    describe("bdd_wmc(f, w)", [&]() {
+      const weight<bdd::label_type> w_one = [](bdd::label_type, bool) { return 1.0; };
+
+      const weight<bdd::label_type> w_prob = [](bdd::label_type, bool v) {
+        return v ? 0.3 : 0.7;
+      };
+
+      it("is the number of assignments for unit weights [1]",
+         [&]() { AssertThat(bdd_wmc(bdd_1, w_one), Is().EqualTo(5.0)); });
+
+      it("is the number of assignments for unit weights [2]",
+         [&]() { AssertThat(bdd_wmc(bdd_2, w_one), Is().EqualTo(3.0)); });
+
+      it("is the probability of f for weights that add up to 1 [2]", [&]() {
+        // x1 | (~x1 & x2)
+        AssertThat(bdd_wmc(bdd_2, w_prob), Is().EqualToWithDelta(0.3 + 0.7 * 0.3, 1e-9));
+      });
+
+      it("is the probability of f for weights that add up to 1 [~2]", [&]() {
+        AssertThat(bdd_wmc(bdd_not(bdd_2), w_prob), Is().EqualToWithDelta(0.7 * 0.7, 1e-9));
+      });
+
+      it("is the probability of f for weights that add up to 1 [1]", [&]() {
+        // ~x0 & x2 & x3  |  x0 & ~x1 & x2 & x3  |  x0 & x1 & x3
+        const double expected = 0.7 * 0.3 * 0.3 + 0.3 * 0.7 * 0.3 * 0.3 + 0.3 * 0.3 * 0.3;
+        AssertThat(bdd_wmc(bdd_1, w_prob), Is().EqualToWithDelta(expected, 1e-9));
+      });
+
+      it("weighs in each literal [2]", [&]() {
+        const weight<bdd::label_type> w = [](bdd::label_type x, bool v) {
+          return x == 1 ? (v ? 2.0 : 0.0) : (v ? 3.0 : 5.0);
+        };
+
+        // x1 must be true (weight 2) and x2 is skipped (weight 3 + 5).
+        AssertThat(bdd_wmc(bdd_2, w), Is().EqualToWithDelta(2.0 * 8.0, 1e-9));
+      });
+
+      it("is 0 for skipped variables whose weights cancel out [2]", [&]() {
+        const weight<bdd::label_type> w = [](bdd::label_type x, bool v) {
+          return x == 2 ? (v ? 1.0 : -1.0) : (v ? 3.0 : 5.0);
+        };
+
+        // If x1 is true, then x2 is skipped (weight 1 - 1). Otherwise, x2 must be true.
+        AssertThat(bdd_wmc(bdd_2, w), Is().EqualToWithDelta(5.0 * 1.0, 1e-9));
+      });
+
+      it("does not overflow on a prefix of many heavy variables", [&]() {
+        domain_set(1100);
+
+        // Skipping each of the first 1050 variables doubles the weight while skipping the last 50
+        // halves it. Hence, the product of the first 1050 variables alone is not representable.
+        const weight<bdd::label_type> w = [](bdd::label_type x, bool /*v*/) {
+          return x < 1050 ? 1.0 : 0.25;
+        };
+
+        AssertThat(bdd_wmc(bdd_ithvar(0), w), Is().EqualTo(std::ldexp(1.0, 1049 - 50)));
+
+        domain_set(empty_dom);
+      });
+
+      it("is the same for external memory [1]", [&]() {
+        const exec_policy ep = exec_policy::memory::External;
+        AssertThat(bdd_wmc(ep, bdd_1, w_prob), Is().EqualToWithDelta(bdd_wmc(bdd_1, w_prob), 1e-9));
+      });
+
+      it("is 0 for the false terminal",
+         [&]() { AssertThat(bdd_wmc(bdd_F, w_prob), Is().EqualTo(0.0)); });
+
+      it("is 1 for the true terminal (without any domain)",
+         [&]() { AssertThat(bdd_wmc(bdd_T, w_prob), Is().EqualTo(1.0)); });
+
+      it("includes the variables of the domain [2]", [&]() {
+        shared_file<bdd::label_type> dom;
+        {
+          ofstream<bdd::label_type> lw(dom);
+          lw << 0 << 1 << 2 << 3;
+        }
+        domain_set(dom);
+
+        AssertThat(bdd_wmc(bdd_2, w_one), Is().EqualTo(12.0));
+        AssertThat(bdd_wmc(bdd_T, w_one), Is().EqualTo(16.0));
+
+        domain_set(empty_dom);
+      });
+
+      it("includes the variables of the BDD outside of the domain [1]", [&]() {
+        shared_file<bdd::label_type> dom;
+        {
+          ofstream<bdd::label_type> lw(dom);
+          lw << 0 << 4;
+        }
+        domain_set(dom);
+
+        AssertThat(bdd_wmc(bdd_1, w_one), Is().EqualTo(10.0));
+
+        domain_set(empty_dom);
+      });
+    });
+
+    describe("bdd_satsample(f, samples, seed, c)", [&]() {
+      using sample_type = std::vector<pair<bdd::label_type, bool>>;
+
+      const auto sample = [](const exec_policy& ep,
+                             const bdd& f,
+                             const size_t samples,
+                             const uint64_t seed) -> std::vector<sample_type> {
+        std::vector<sample_type> out(samples);
+        bdd_satsample(
+          ep, f, samples, seed, [&out](const pair<size_t, pair<bdd::label_type, bool>>& x) {
+            out.at(x.first).push_back(x.second);
+          });
+        return out;
+      };
+
+      it("provides each sample as a satisfying assignment in ascending order [1]", [&]() {
+        const std::vector<sample_type> out = sample(exec_policy(), bdd_1, 100u, 42u);
+
+        for (const sample_type& s : out) {
+          AssertThat(s.size(), Is().EqualTo(4u));
+          for (size_t i = 0u; i < s.size(); ++i) { AssertThat(s.at(i).first, Is().EqualTo(i)); }
+          AssertThat(bdd_eval(bdd_1, s.begin(), s.end()), Is().True());
+        }
+      });
+
+      it("provides each sample as a satisfying assignment in ascending order [~1]", [&]() {
+        const std::vector<sample_type> out = sample(exec_policy(), bdd_not(bdd_1), 100u, 42u);
+
+        for (const sample_type& s : out) {
+          AssertThat(s.size(), Is().EqualTo(4u));
+          AssertThat(bdd_eval(bdd_not(bdd_1), s.begin(), s.end()), Is().True());
+        }
+      });
+
+      it("assigns levels skipped by an arc [4]", [&]() {
+        const std::vector<sample_type> out = sample(exec_policy(), bdd_4, 100u, 42u);
+
+        for (const sample_type& s : out) {
+          AssertThat(s.size(), Is().EqualTo(4u));
+          for (size_t i = 0u; i < s.size(); ++i) {
+            AssertThat(s.at(i).first, Is().EqualTo(2u * i));
+          }
+          AssertThat(bdd_eval(bdd_4, s.begin(), s.end()), Is().True());
+        }
+      });
+
+      it("draws each satisfying assignment (roughly) uniformly [2]", [&]() {
+        // Satisfying assignments to (x1, x2): (0,1), (1,0), and (1,1).
+        const std::vector<sample_type> out = sample(exec_policy(), bdd_2, 3000u, 42u);
+
+        size_t hits[2][2] = { { 0u, 0u }, { 0u, 0u } };
+        for (const sample_type& s : out) {
+          AssertThat(s.size(), Is().EqualTo(2u));
+          hits[s.at(0).second][s.at(1).second] += 1u;
+        }
+
+        AssertThat(hits[false][false], Is().EqualTo(0u));
+        AssertThat(hits[false][true], Is().GreaterThan(800u).And().LessThan(1200u));
+        AssertThat(hits[true][false], Is().GreaterThan(800u).And().LessThan(1200u));
+        AssertThat(hits[true][true], Is().GreaterThan(800u).And().LessThan(1200u));
+      });
+
+      it("draws the same samples for the same seed", [&]() {
+        const std::vector<sample_type> out_a = sample(exec_policy(), bdd_1, 100u, 42u);
+        const std::vector<sample_type> out_b = sample(exec_policy(), bdd_1, 100u, 42u);
+
+        AssertThat(out_a == out_b, Is().True());
+      });
+
+      it("draws the same samples independent of the memory mode", [&]() {
+        const std::vector<sample_type> out_a =
+          sample(exec_policy::memory::Internal, bdd_1, 100u, 42u);
+        const std::vector<sample_type> out_b =
+          sample(exec_policy::memory::External, bdd_1, 100u, 42u);
+
+        AssertThat(out_a == out_b, Is().True());
+      });
+
+      it("draws different samples for different seeds", [&]() {
+        const std::vector<sample_type> out_a = sample(exec_policy(), bdd_1, 100u, 42u);
+        const std::vector<sample_type> out_b = sample(exec_policy(), bdd_1, 100u, 21u);
+
+        AssertThat(out_a == out_b, Is().False());
+      });
+
+      it("does not call the consumer for the true terminal", [&]() {
+        size_t calls = 0u;
+        bdd_satsample(bdd_T, 10u, 42u, [&calls](const pair<size_t, pair<bdd::label_type, bool>>&) {
+          calls++;
+        });
+        AssertThat(calls, Is().EqualTo(0u));
+      });
+
+      it("throws for the false terminal", [&]() {
+        AssertThrows(
+          invalid_argument,
+          bdd_satsample(bdd_F, 10u, 42u, [](const pair<size_t, pair<bdd::label_type, bool>>&) {}));
+      });
+
+      it("does not throw for the false terminal with no samples", [&]() {
+        bdd_satsample(bdd_F, 0u, 42u, [](const pair<size_t, pair<bdd::label_type, bool>>&) {});
+      });
+    });
+
     describe("bdd_satcount(f) [non-empty dom]", [&]() {
       shared_file<bdd::label_type> dom;
       {
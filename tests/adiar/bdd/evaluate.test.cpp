@@ -316,6 +316,76 @@ go_bandit([]() {
           AssertThat(call_history.at(2), Is().EqualTo(5));
         });
       });
+
+      describe("bdd_eval_batch(const bdd&, size_t, const function<...>&)", [&]() {
+        // The a'th assignment sets x_i to the i'th bit of (a % 32).
+        const auto xs = [](bdd::label_type x, size_t block) -> uint64_t {
+          uint64_t res = 0u;
+          for (size_t j = 0u; j < 64u; ++j) {
+            const size_t a = 64u * block + j;
+            if (((a % 32u) >> x) & 1u) { res |= uint64_t(1u) << j; }
+          }
+          return res;
+        };
+
+        // The expected result by evaluating each assignment on its own.
+        const auto expected = [&xs](const adiar::bdd& f, size_t n) -> std::vector<uint64_t> {
+          std::vector<uint64_t> res((n + 63u) / 64u, 0u);
+          for (size_t a = 0u; a < n; ++a) {
+            const bool value = bdd_eval(f, [&xs, &a](bdd::label_type x) {
+              return static_cast<bool>((xs(x, a / 64u) >> (a % 64u)) & 1u);
+            });
+            if (value) { res[a / 64u] |= uint64_t(1u) << (a % 64u); }
+          }
+          return res;
+        };
+
+        it("returns nothing for no assignments", [&]() {
+          AssertThat(bdd_eval_batch(bdd, 0u, xs).size(), Is().EqualTo(0u));
+        });
+
+        it("agrees with bdd_eval on all 32 assignments", [&]() {
+          AssertThat(bdd_eval_batch(bdd, 32u, xs), Is().EqualTo(expected(bdd, 32u)));
+        });
+
+        it("agrees with bdd_eval on all 32 assignments [skip_bdd]", [&]() {
+          AssertThat(bdd_eval_batch(skip_bdd, 32u, xs), Is().EqualTo(expected(skip_bdd, 32u)));
+        });
+
+        it("agrees with bdd_eval on all 32 assignments [~skip_bdd]", [&]() {
+          const adiar::bdd f(skip_bdd, true);
+          AssertThat(bdd_eval_batch(f, 32u, xs), Is().EqualTo(expected(f, 32u)));
+        });
+
+        it("agrees with bdd_eval over multiple blocks", [&]() {
+          const std::vector<uint64_t> out = bdd_eval_batch(bdd, 150u, xs);
+
+          AssertThat(out.size(), Is().EqualTo(3u));
+          AssertThat(out, Is().EqualTo(expected(bdd, 150u)));
+          AssertThat(out.at(2) >> (150u - 128u), Is().EqualTo(0u));
+        });
+
+        it("agrees with bdd_eval over multiple blocks [External]", [&]() {
+          const exec_policy ep = exec_policy::memory::External;
+          AssertThat(bdd_eval_batch(ep, bdd, 150u, xs), Is().EqualTo(expected(bdd, 150u)));
+        });
+
+        it("returns all assignments for the true terminal", [&]() {
+          const std::vector<uint64_t> out = bdd_eval_batch(bdd_T, 70u, xs);
+
+          AssertThat(out.size(), Is().EqualTo(2u));
+          AssertThat(out.at(0), Is().EqualTo(~uint64_t(0u)));
+          AssertThat(out.at(1), Is().EqualTo(uint64_t(0x3Fu)));
+        });
+
+        it("returns no assignments for the false terminal", [&]() {
+          const std::vector<uint64_t> out = bdd_eval_batch(bdd_F, 70u, xs);
+
+          AssertThat(out.size(), Is().EqualTo(2u));
+          AssertThat(out.at(0), Is().EqualTo(0u));
+          AssertThat(out.at(1), Is().EqualTo(0u));
+        });
+      });
     } // bdd_eval
 
     { // bdd_satmin, bdd_satmax
@@ -445,6 +515,13 @@ go_bandit([]() {
       }
 
       describe("bdd_satmin(const bdd&)", [&]() {
+        it("returns the same cube with an external memory stack", [&]() {
+          const exec_policy ep = exec_policy::memory::External;
+
+          AssertThat(bdd_satmin(ep, bdd_1) == bdd_satmin(bdd_1), Is().True());
+          AssertThat(bdd_satmin(ep, bdd_not(bdd_1)) == bdd_satmin(bdd_not(bdd_1)), Is().True());
+        });
+
         it("returns same file for false terminal", [&]() {
           const bdd out = bdd_satmin(bdd_F);
           AssertThat(out.file_ptr(), Is().EqualTo(bdd_F));
@@ -1009,6 +1086,19 @@ go_bandit([]() {
       });
 
       describe("bdd_satmin(const bdd&, const generator<...>&)", [&]() {
+        it("returns the same cube with an external memory stack", [&]() {
+          const exec_policy ep = exec_policy::memory::External;
+
+          const auto gen = []() -> generator<bdd::label_type> {
+            return [x = 0]() mutable -> optional<bdd::label_type> {
+              if (x > 4) { return {}; }
+              return { x++ };
+            };
+          };
+
+          AssertThat(bdd_satmin(ep, bdd_1, gen()) == bdd_satmin(bdd_1, gen()), Is().True());
+        });
+
         it("returns same file for false terminal", [&]() {
           const generator<bdd::label_type> gen = [x = 0]() mutable -> optional<bdd::label_type> {
             if (x > 2) { return {}; }
@@ -2167,6 +2257,13 @@ go_bandit([]() {
       });
 
       describe("bdd_satmax(const bdd&)", [&]() {
+        it("returns the same cube with an external memory stack", [&]() {
+          const exec_policy ep = exec_policy::memory::External;
+
+          AssertThat(bdd_satmax(ep, bdd_1) == bdd_satmax(bdd_1), Is().True());
+          AssertThat(bdd_satmax(ep, bdd_not(bdd_1)) == bdd_satmax(bdd_not(bdd_1)), Is().True());
+        });
+
         it("returns same file for false terminal", [&]() {
           const bdd out = bdd_satmax(bdd_F);
           AssertThat(out.file_ptr(), Is().EqualTo(bdd_F));
@@ -2675,6 +2772,19 @@ go_bandit([]() {
       });
 
       describe("bdd_satmax(const bdd&, const generator<...>&)", [&]() {
+        it("returns the same cube with an external memory stack", [&]() {
+          const exec_policy ep = exec_policy::memory::External;
+
+          const auto gen = []() -> generator<bdd::label_type> {
+            return [x = 0]() mutable -> optional<bdd::label_type> {
+              if (x > 4) { return {}; }
+              return { x++ };
+            };
+          };
+
+          AssertThat(bdd_satmax(ep, bdd_1, gen()) == bdd_satmax(bdd_1, gen()), Is().True());
+        });
+
         it("returns same file for false terminal", [&]() {
           const generator<bdd::label_type> gen = [x = 0]() mutable -> optional<bdd::label_type> {
             if (x > 2) { return {}; }
@@ -3825,6 +3935,105 @@ go_bandit([]() {
           AssertThat(out.at(3), Is().EqualTo(pair_type{ 5, true }));
         });
       });
+
+      describe("bdd_satall(const bdd&, const consumer<...>&)", [&]() {
+        using pair_type   = pair<bdd::label_type, bool>;
+        using cube_type   = std::vector<pair_type>;
+        using output_type = std::vector<cube_type>;
+
+        const auto satall = [](const bdd& f, const exec_policy& ep = exec_policy()) -> output_type {
+          output_type out;
+          bdd_satall(ep, f, [&out](const generator<pair_type>& g) {
+            cube_type cube;
+            optional<pair_type> x;
+            while ((x = g())) { cube.push_back(x.value()); }
+            out.push_back(cube);
+          });
+          return out;
+        };
+
+        it("outputs nothing for false terminal", [&]() {
+          const output_type out = satall(bdd_F);
+          AssertThat(out.size(), Is().EqualTo(0u));
+        });
+
+        it("outputs a single empty cube for true terminal", [&]() {
+          const output_type out = satall(bdd_T);
+          AssertThat(out.size(), Is().EqualTo(1u));
+          AssertThat(out.at(0).size(), Is().EqualTo(0u));
+        });
+
+        it("outputs the single cube for [0]", [&]() {
+          const output_type out = satall(bdd_0);
+          AssertThat(out.size(), Is().EqualTo(1u));
+          AssertThat(out.at(0), Is().EqualTo(cube_type{ { 0, true } }));
+        });
+
+        it("outputs the single cube for [~0]", [&]() {
+          const output_type out = satall(bdd(bdd_0, true));
+          AssertThat(out.size(), Is().EqualTo(1u));
+          AssertThat(out.at(0), Is().EqualTo(cube_type{ { 0, false } }));
+        });
+
+        it("outputs the single cube for [0(+2)]", [&]() {
+          const output_type out = satall(bdd(bdd_0, false, +2));
+          AssertThat(out.size(), Is().EqualTo(1u));
+          AssertThat(out.at(0), Is().EqualTo(cube_type{ { 2, true } }));
+        });
+
+        it("outputs all cubes in lexicographical order for [1]", [&]() {
+          const output_type out = satall(bdd_1);
+          AssertThat(out.size(), Is().EqualTo(3u));
+          AssertThat(
+            out.at(0),
+            Is().EqualTo(cube_type{ { 0, false }, { 1, false }, { 2, true }, { 3, true } }));
+          AssertThat(out.at(1),
+                     Is().EqualTo(cube_type{ { 0, false }, { 1, true }, { 2, false } }));
+          AssertThat(out.at(2), Is().EqualTo(cube_type{ { 0, true }, { 2, false } }));
+        });
+
+        it("outputs all cubes in lexicographical order for [3]", [&]() {
+          const output_type out = satall(bdd_3);
+          AssertThat(out.size(), Is().EqualTo(3u));
+          AssertThat(out.at(0),
+                     Is().EqualTo(cube_type{ { 1, false }, { 3, false }, { 5, false } }));
+          AssertThat(out.at(1), Is().EqualTo(cube_type{ { 1, false }, { 3, true }, { 5, true } }));
+          AssertThat(out.at(2), Is().EqualTo(cube_type{ { 1, true }, { 5, true } }));
+        });
+
+        it("outputs cubes that cover the same number of assignments as bdd_satcount(f) [2]", [&]() {
+          const output_type out = satall(bdd_2);
+
+          uint64_t assignments = 0u;
+          for (const cube_type& cube : out) { assignments += 1u << (4u - cube.size()); }
+          AssertThat(assignments, Is().EqualTo(bdd_satcount(bdd_2, 4u)));
+        });
+
+        it("outputs all cubes in lexicographical order for [1] [external memory]", [&]() {
+          const output_type out = satall(bdd_1, exec_policy::memory::External);
+          AssertThat(out.size(), Is().EqualTo(3u));
+          AssertThat(
+            out.at(0),
+            Is().EqualTo(cube_type{ { 0, false }, { 1, false }, { 2, true }, { 3, true } }));
+          AssertThat(out.at(1),
+                     Is().EqualTo(cube_type{ { 0, false }, { 1, true }, { 2, false } }));
+          AssertThat(out.at(2), Is().EqualTo(cube_type{ { 0, true }, { 2, false } }));
+        });
+
+        it("outputs all cubes in lexicographical order for [3] [external memory]", [&]() {
+          const output_type out = satall(bdd_3, exec_policy::memory::External);
+          AssertThat(out.size(), Is().EqualTo(3u));
+          AssertThat(out.at(0),
+                     Is().EqualTo(cube_type{ { 1, false }, { 3, false }, { 5, false } }));
+          AssertThat(out.at(1), Is().EqualTo(cube_type{ { 1, false }, { 3, true }, { 5, true } }));
+          AssertThat(out.at(2), Is().EqualTo(cube_type{ { 1, true }, { 5, true } }));
+        });
+
+        it("outputs the same cubes with external memory as with internal memory [2]", [&]() {
+          AssertThat(satall(bdd_2, exec_policy::memory::External),
+                     Is().EqualTo(satall(bdd_2, exec_policy::memory::Internal)));
+        });
+      });
     } // bdd_satmin, bdd_satmax
   });
 });
@@ -701,5 +701,127 @@ go_bandit([]() {
         AssertThat(call_history.at(1), Is().EqualTo(2));
       });
     });
+
+    describe("optmin(bdd, cost<...>, size_t, consumer<...>)", [&]() {
+      // Store result in `res`
+      std::vector<pair<size_t, pair<int, bool>>> res;
+
+      before_each([&]() { res.clear(); });
+
+      const auto c = [&res](const pair<size_t, pair<int, bool>>& ixa) -> void {
+        res.push_back({ ixa.first, { static_cast<int>(ixa.second.first), ixa.second.second } });
+      };
+
+      it("returns no solutions for false terminal", [&]() {
+        const std::vector<double> costs = bdd_optmin(bdd_F, [](int) { return 1.0; }, 3u, c);
+
+        AssertThat(costs.size(), Is().EqualTo(0u));
+        AssertThat(res.size(), Is().EqualTo(0u));
+      });
+
+      it("returns a single solution of cost 0 for true terminal", [&]() {
+        const std::vector<double> costs = bdd_optmin(bdd_T, [](int) { return 1.0; }, 3u, c);
+
+        AssertThat(costs.size(), Is().EqualTo(1u));
+        AssertThat(costs.at(0), Is().EqualTo(0.0));
+        AssertThat(res.size(), Is().EqualTo(0u));
+      });
+
+      it("returns no solutions for k = 0", [&]() {
+        const std::vector<double> costs = bdd_optmin(bdd_1, [](int) { return 1.0; }, 0u, c);
+
+        AssertThat(costs.size(), Is().EqualTo(0u));
+        AssertThat(res.size(), Is().EqualTo(0u));
+      });
+
+      it("returns the 3 cheapest solutions for BDD 1 [(x) -> 1]", [&]() {
+        const std::vector<double> costs = bdd_optmin(bdd_1, [](int) { return 1.0; }, 3u, c);
+
+        AssertThat(costs.size(), Is().EqualTo(3u));
+        AssertThat(costs.at(0), Is().EqualTo(1.0));
+        AssertThat(costs.at(1), Is().EqualTo(2.0));
+        AssertThat(costs.at(2), Is().EqualTo(2.0));
+
+        // The cheapest solution is only x0
+        size_t solution0_size = 0u;
+        for (const auto& ixa : res) {
+          AssertThat(ixa.first, Is().LessThan(3u));
+          if (ixa.first == 0u) {
+            AssertThat(ixa.second, Is().EqualTo(make_pair(0, true)));
+            solution0_size += 1u;
+          }
+        }
+        AssertThat(solution0_size, Is().EqualTo(1u));
+      });
+
+      it("returns all paths to true if k exceeds their number for BDD 1 [(x) -> 1]", [&]() {
+        const std::vector<double> costs = bdd_optmin(bdd_1, [](int) { return 1.0; }, 10u, c);
+
+        AssertThat(costs.size(), Is().EqualTo(6u));
+        AssertThat(costs.at(0), Is().EqualTo(1.0));
+        for (size_t i = 1; i < costs.size(); ++i) { AssertThat(costs.at(i), Is().EqualTo(2.0)); }
+      });
+
+      it("returns the same cost as 'bdd_optmin(f, c)' for k = 1 on BDD 2 [(x) -> (8-x)^2]",
+         [&]() {
+           const auto cost_fn = [](int x) -> double { return (8 - x) * (8 - x); };
+
+           const std::vector<double> costs = bdd_optmin(bdd_2, cost_fn, 1u, c);
+
+           AssertThat(costs.size(), Is().EqualTo(1u));
+           AssertThat(costs.at(0), Is().EqualTo(bdd_optmin(bdd_2, cost_fn).second));
+
+           AssertThat(res.size(), Is().EqualTo(5u));
+           AssertThat(res.at(0).second, Is().EqualTo(make_pair(8, true)));
+           AssertThat(res.at(4).second, Is().EqualTo(make_pair(0, false)));
+         });
+    });
+
+    describe("optmin(bdd, std::vector<cost<...>>, size_t)", [&]() {
+      const std::vector<cost<bdd::label_type>> cs = {
+        [](bdd::label_type) -> double { return 1.0; },
+        [](bdd::label_type x) -> double { return x; },
+      };
+
+      it("throws 'invalid_argument' without any cost functions", [&]() {
+        AssertThrows(invalid_argument, bdd_optmin(bdd_1, std::vector<cost<bdd::label_type>>()));
+      });
+
+      it("returns [T, (0,0)] for true terminal", [&]() {
+        const auto res = bdd_optmin(bdd_T, cs);
+
+        AssertThat(res.size(), Is().EqualTo(1u));
+        AssertThat(bdd_istrue(res.at(0).first), Is().True());
+        AssertThat(res.at(0).second, Is().EqualTo(std::vector<double>{ 0.0, 0.0 }));
+      });
+
+      it("breaks ties with the second objective for BDD 1", [&]() {
+        const auto res = bdd_optmin(bdd_1, cs, 3u);
+
+        AssertThat(res.size(), Is().EqualTo(3u));
+
+        AssertThat(res.at(0).second, Is().EqualTo(std::vector<double>{ 1.0, 0.0 }));
+        AssertThat(res.at(1).second, Is().EqualTo(std::vector<double>{ 2.0, 4.0 }));
+        AssertThat(res.at(2).second, Is().EqualTo(std::vector<double>{ 2.0, 5.0 }));
+
+        // x0
+        node_test_ifstream ns0(res.at(0).first);
+        AssertThat(ns0.can_pull(), Is().True());
+        AssertThat(ns0.pull(), Is().EqualTo(node(0, bdd::max_id, terminal_F, terminal_T)));
+        AssertThat(ns0.can_pull(), Is().False());
+
+        // ~x0 & x1 & x3
+        node_test_ifstream ns1(res.at(1).first);
+        AssertThat(ns1.can_pull(), Is().True());
+        AssertThat(ns1.pull(), Is().EqualTo(node(3, bdd::max_id, terminal_F, terminal_T)));
+        AssertThat(ns1.can_pull(), Is().True());
+        AssertThat(ns1.pull(),
+                   Is().EqualTo(node(1, bdd::max_id, terminal_F, ptr_uint64(3, bdd::max_id))));
+        AssertThat(ns1.can_pull(), Is().True());
+        AssertThat(ns1.pull(),
+                   Is().EqualTo(node(0, bdd::max_id, ptr_uint64(1, bdd::max_id), terminal_F)));
+        AssertThat(ns1.can_pull(), Is().False());
+      });
+    });
   });
 });
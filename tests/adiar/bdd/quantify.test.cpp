@@ -2,6 +2,26 @@
 #include <algorithm>
 #include <vector>
 
+#include <adiar/internal/algorithms/quantify.h>
+
+// Restores the memory limit at the end of its scope, even if an assertion fails.
+class memory_limit_guard
+{
+  const size_t _prev;
+
+public:
+  memory_limit_guard(const size_t memory_limit)
+    : _prev(adiar_memory_limit())
+  {
+    adiar_set_memory_limit(memory_limit);
+  }
+
+  ~memory_limit_guard()
+  {
+    adiar_set_memory_limit(_prev);
+  }
+};
+
 go_bandit([]() {
   describe("adiar/bdd/quantify.cpp", []() {
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -3855,6 +3875,53 @@ go_bandit([]() {
           AssertThat(call_history.at(10), Is().EqualTo(1u));
         });
       });
+      describe("algorithm: Auto", [&]() {
+        const exec_policy ep = exec_policy::quantify::Auto;
+
+        it("quantifies odd variables in BDD 4 [&&]", [&]() {
+          const bdd out =
+            bdd_exists(ep, bdd(bdd_4), [](const bdd::label_type x) -> bool { return x % 2; });
+
+          const bdd expected = bdd_exists(exec_policy::quantify::Singleton,
+                                          bdd(bdd_4),
+                                          [](const bdd::label_type x) -> bool { return x % 2; });
+
+          AssertThat(out == expected, Is().True());
+        });
+
+        it("quantifies single variable in BDD 4 [&&]", [&]() {
+          const bdd out =
+            bdd_exists(ep, bdd(bdd_4), [](const bdd::label_type x) -> bool { return x == 2; });
+
+          const bdd expected = bdd_exists(bdd(bdd_4), 2);
+
+          AssertThat(out == expected, Is().True());
+        });
+
+        it("quantifies even variables in BDD 10 [const &]", [&]() {
+          const bdd in  = bdd_10;
+          const bdd out =
+            bdd_exists(ep, in, [](const bdd::label_type x) -> bool { return !(x % 2); });
+
+          const bdd expected = bdd_exists(exec_policy::quantify::Nested,
+                                          in,
+                                          [](const bdd::label_type x) -> bool { return !(x % 2); });
+
+          AssertThat(out == expected, Is().True());
+        });
+
+        it("collapses to terminal when quantifying all variables in BDD 4 [&&]", [&]() {
+          const bdd out =
+            bdd_exists(ep, bdd(bdd_4), [](const bdd::label_type) -> bool { return true; });
+
+          node_test_ifstream out_nodes(out);
+
+          AssertThat(out_nodes.can_pull(), Is().True());
+          AssertThat(out_nodes.pull(), Is().EqualTo(node(true)));
+
+          AssertThat(out_nodes.can_pull(), Is().False());
+        });
+      });
     });
 
     describe("bdd_exists(__bdd&&, const predicate<bdd::label_type>&)", [&]() {
@@ -7227,5 +7294,65 @@ go_bandit([]() {
         });
       });
     });
+
+    describe("bdd_exists(const bdd&, const predicate<bdd::label_type>&) with little memory", [&]() {
+      const auto pred = [](const bdd::label_type x) -> bool { return !(x % 2); };
+
+      it("quantifies even variables in BDD 10 with Nested Sweeping in external memory", [&]() {
+        const bdd in       = bdd_10;
+        const bdd expected = bdd_exists(exec_policy::quantify::Nested, in, pred);
+
+        const size_t memory_limit = adiar_memory_limit();
+#ifdef ADIAR_STATS
+        const auto low_memory_before = stats_quantify.low_memory;
+#endif
+
+        bdd out;
+        {
+          const memory_limit_guard g(minimum_memory);
+
+          const exec_policy ep =
+            exec_policy(exec_policy::quantify::Nested).set(exec_policy::memory::External);
+          out = bdd_exists(ep, in, pred);
+        }
+        AssertThat(adiar_memory_limit(), Is().EqualTo(memory_limit));
+
+#ifdef ADIAR_STATS
+        AssertThat(stats_quantify.low_memory > low_memory_before, Is().True());
+#endif
+        AssertThat(out == expected, Is().True());
+      });
+
+      it("quantifies even variables in BDD 10 given by a generator", [&]() {
+        const bdd in       = bdd_10;
+        const bdd expected = bdd_exists(exec_policy::quantify::Singleton, in, pred);
+
+        const size_t memory_limit = adiar_memory_limit();
+#ifdef ADIAR_STATS
+        const auto low_memory_before = stats_quantify.low_memory;
+#endif
+
+        bdd out;
+        {
+          const memory_limit_guard g(minimum_memory);
+
+          const exec_policy ep =
+            exec_policy(exec_policy::quantify::Nested).set(exec_policy::memory::External);
+          out = bdd_exists(ep, in, [var = 4]() mutable -> optional<bdd::label_type> {
+            if (var < 0) { return {}; }
+
+            const bdd::label_type ret = var;
+            var -= 2;
+            return { ret };
+          });
+        }
+        AssertThat(adiar_memory_limit(), Is().EqualTo(memory_limit));
+
+#ifdef ADIAR_STATS
+        AssertThat(stats_quantify.low_memory > low_memory_before, Is().True());
+#endif
+        AssertThat(out == expected, Is().True());
+      });
+    });
   });
 });
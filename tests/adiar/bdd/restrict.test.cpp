@@ -664,6 +664,104 @@ go_bandit([]() {
       });
     });
 
+    describe("bdd_restrict(const std::vector<bdd>&, const generator<...>&)", [&]() {
+      it("returns the inputs as-is for an empty assignment", [&]() {
+        const std::vector<bdd> fs = { bdd_1, bdd_T };
+        const std::vector<adiar::pair<bdd::label_type, bool>> ass;
+
+        const std::vector<__bdd> out = bdd_restrict(fs, make_generator(ass.begin(), ass.end()));
+
+        AssertThat(out.size(), Is().EqualTo(2u));
+        AssertThat(out.at(0).get<__bdd::shared_node_file_type>(), Is().EqualTo(bdd_1));
+        AssertThat(out.at(1).get<__bdd::shared_node_file_type>(), Is().EqualTo(bdd_T));
+      });
+
+      it("bridges levels in BDD 1 for (_,T,T,_) as for a single BDD", [&]() {
+        const std::vector<bdd> fs = { bdd_1, bdd_4 };
+        const std::vector<adiar::pair<bdd::label_type, bool>> ass = { { 1, true }, { 2, true } };
+
+        const std::vector<__bdd> out = bdd_restrict(fs, make_generator(ass.begin(), ass.end()));
+
+        AssertThat(out.size(), Is().EqualTo(2u));
+
+        arc_test_ifstream arcs(out.at(0));
+
+        AssertThat(arcs.can_pull_internal(), Is().True());
+        AssertThat(arcs.pull_internal(), Is().EqualTo(arc{ n1_1.uid(), true, n1_5.uid() }));
+
+        AssertThat(arcs.can_pull_internal(), Is().False());
+
+        AssertThat(arcs.can_pull_terminal(), Is().True());
+        AssertThat(arcs.pull_terminal(), Is().EqualTo(arc{ n1_1.uid(), false, terminal_T }));
+
+        AssertThat(arcs.can_pull_terminal(), Is().True());
+        AssertThat(arcs.pull_terminal(), Is().EqualTo(arc{ n1_5.uid(), false, terminal_F }));
+
+        AssertThat(arcs.can_pull_terminal(), Is().True());
+        AssertThat(arcs.pull_terminal(), Is().EqualTo(arc{ n1_5.uid(), true, terminal_T }));
+
+        AssertThat(arcs.can_pull_terminal(), Is().False());
+
+        level_info_test_ifstream meta_arcs(out.at(0));
+
+        AssertThat(meta_arcs.can_pull(), Is().True());
+        AssertThat(meta_arcs.pull(), Is().EqualTo(level_info(0, 1u)));
+
+        AssertThat(meta_arcs.can_pull(), Is().True());
+        AssertThat(meta_arcs.pull(), Is().EqualTo(level_info(3, 1u)));
+
+        AssertThat(meta_arcs.can_pull(), Is().False());
+
+        AssertThat(out.at(0).get<__bdd::shared_arc_file_type>()->max_1level_cut,
+                   Is().GreaterThanOrEqualTo(1u));
+        AssertThat(out.at(0).get<__bdd::shared_arc_file_type>()->max_1level_cut,
+                   Is().LessThanOrEqualTo(1u));
+      });
+
+      it("agrees with restricting each BDD on its own", [&]() {
+        const std::vector<bdd> fs = {
+          bdd_1, bdd_2_high_F, bdd_F, bdd_3, bdd_4, bdd_5, bdd(bdd_1, true),
+        };
+        const std::vector<adiar::pair<bdd::label_type, bool>> ass = { { 0, false }, { 2, true } };
+
+        std::vector<__bdd> out = bdd_restrict(fs, make_generator(ass.begin(), ass.end()));
+
+        AssertThat(out.size(), Is().EqualTo(fs.size()));
+        for (size_t i = 0u; i < fs.size(); ++i) {
+          __bdd expected = bdd_restrict(fs.at(i), make_generator(ass.begin(), ass.end()));
+          AssertThat(std::move(out.at(i)) == std::move(expected), Is().True());
+        }
+      });
+
+      it("restricts BDD 1 to a terminal while others remain", [&]() {
+        const std::vector<bdd> fs = { bdd_1, bdd_5 };
+        const std::vector<adiar::pair<bdd::label_type, bool>> ass = { { 0, false }, { 2, true } };
+
+        const std::vector<__bdd> out = bdd_restrict(fs, make_generator(ass.begin(), ass.end()));
+
+        AssertThat(out.at(0).has<__bdd::shared_node_file_type>(), Is().True());
+
+        node_test_ifstream out_nodes(out.at(0));
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(true)));
+        AssertThat(out_nodes.can_pull(), Is().False());
+
+        AssertThat(out.at(1).has<__bdd::shared_arc_file_type>(), Is().True());
+      });
+
+      it("returns an unaffected BDD as-is", [&]() {
+        const std::vector<bdd> fs = { bdd_1, bdd_4 };
+        const std::vector<adiar::pair<bdd::label_type, bool>> ass = { { 3, true } };
+
+        const std::vector<__bdd> out =
+          bdd_restrict(exec_policy::memory::External, fs, make_generator(ass.begin(), ass.end()));
+
+        AssertThat(out.at(0).has<__bdd::shared_arc_file_type>(), Is().True());
+        AssertThat(out.at(1).get<__bdd::shared_node_file_type>(), Is().EqualTo(bdd_4));
+      });
+    });
+
     describe("bdd_restrict(const bdd&, bdd::label_type, bool)", [&]() {
       it("bridges over a level in BDD 1 for x2 = T", [&]() {
         /*
@@ -106,6 +106,10 @@ go_bandit([]() {
           ep.set(exec_policy::quantify::Nested);
           AssertThat(ep.template get<exec_policy::quantify::algorithm>(),
                      Is().EqualTo(exec_policy::quantify::Nested));
+
+          ep.set(exec_policy::quantify::Auto);
+          AssertThat(ep.template get<exec_policy::quantify::algorithm>(),
+                     Is().EqualTo(exec_policy::quantify::Auto));
         });
 
         it("can set settigs with a builder pattern syntax", [&]() {
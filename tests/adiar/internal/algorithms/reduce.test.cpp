@@ -3424,5 +3424,220 @@ go_bandit([]() {
         AssertThat(out->number_of_terminals[true], Is().EqualTo(1u));
       });
     });
+
+    describe("Cut of each level", [&]() {
+      it("includes arcs into, out of, and across each level", [&]() {
+        /*
+        //           1                  1      ---- x0
+        //          / \                / \
+        //          | 2_               | 2     ---- x1
+        //          | | \      =>      |/ \
+        //          3 4 T              4  T    ---- x2
+        //          |X|               / \
+        //          F T               F T
+        */
+
+        const arc::uid_type n1(0, 0);
+        const arc::uid_type n2(1, 0);
+        const arc::uid_type n3(2, 0);
+        const arc::uid_type n4(2, 1);
+
+        shared_levelized_file<arc> in;
+
+        { // Garbage collect writer to free write-lock
+          arc_ofstream aw(in);
+
+          aw.push_internal({ n1, true, n2 });
+          aw.push_internal({ n1, false, n3 });
+          aw.push_internal({ n2, false, n4 });
+
+          aw.push_terminal({ n2, true, terminal_T });
+          aw.push_terminal({ n3, false, terminal_F });
+          aw.push_terminal({ n3, true, terminal_T });
+          aw.push_terminal({ n4, false, terminal_F });
+          aw.push_terminal({ n4, true, terminal_T });
+
+          aw.push(level_info(0, 1u));
+          aw.push(level_info(1, 1u));
+          aw.push(level_info(2, 2u));
+        }
+
+        in->max_1level_cut = 2;
+
+        // Reduce it
+        bdd out(__bdd(in, exec_policy()));
+
+        level_info_test_ifstream out_meta(out);
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        const level_info li_2 = out_meta.pull();
+        AssertThat(li_2.has_max_2level_cut(), Is().True());
+        AssertThat(li_2.max_2level_cut(), Is().EqualTo(2u));
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        const level_info li_1 = out_meta.pull();
+        AssertThat(li_1.has_max_2level_cut(), Is().True());
+        AssertThat(li_1.max_2level_cut(), Is().EqualTo(3u));
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        const level_info li_0 = out_meta.pull();
+        AssertThat(li_0.has_max_2level_cut(), Is().True());
+        AssertThat(li_0.max_2level_cut(), Is().EqualTo(2u));
+
+        AssertThat(out_meta.can_pull(), Is().False());
+
+        AssertThat(out->level_cut_slack, Is().EqualTo(0u));
+        AssertThat(out->max_2level_cut[cut::Internal], Is().EqualTo(3u));
+      });
+
+      it("adds arcs redirected by Reduction Rule 1 to the slack", [&]() {
+        /*
+        //           1                  1      ---- x0
+        //          / \                / \
+        //          2  \               |  \    ---- x1
+        //          ||  \      =>      |   \
+        //          4   5              4   5   ---- x2
+        //         / \ / \            / \ / \
+        //         F T T F            F T T F
+        */
+
+        const arc::uid_type n1(0, 0);
+        const arc::uid_type n2(1, 0);
+        const arc::uid_type n4(2, 0);
+        const arc::uid_type n5(2, 1);
+
+        shared_levelized_file<arc> in;
+
+        { // Garbage collect writer to free write-lock
+          arc_ofstream aw(in);
+
+          aw.push_internal({ n1, false, n2 });
+          aw.push_internal({ n2, false, n4 });
+          aw.push_internal({ n2, true, n4 });
+          aw.push_internal({ n1, true, n5 });
+
+          aw.push_terminal({ n4, false, terminal_F });
+          aw.push_terminal({ n4, true, terminal_T });
+          aw.push_terminal({ n5, false, terminal_T });
+          aw.push_terminal({ n5, true, terminal_F });
+
+          aw.push(level_info(0, 1u));
+          aw.push(level_info(1, 1u));
+          aw.push(level_info(2, 2u));
+        }
+
+        in->max_1level_cut = 3;
+
+        // Reduce it
+        bdd out(__bdd(in, exec_policy()));
+
+        level_info_test_ifstream out_meta(out);
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        const level_info li_2 = out_meta.pull();
+        AssertThat(li_2.level(), Is().EqualTo(2u));
+        AssertThat(li_2.has_max_2level_cut(), Is().True());
+        AssertThat(li_2.max_2level_cut(), Is().EqualTo(3u));
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        const level_info li_0 = out_meta.pull();
+        AssertThat(li_0.level(), Is().EqualTo(0u));
+        AssertThat(li_0.has_max_2level_cut(), Is().True());
+        AssertThat(li_0.max_2level_cut(), Is().EqualTo(1u));
+
+        AssertThat(out_meta.can_pull(), Is().False());
+
+        // The arc from (1) to (4) is not part of the cut at x0.
+        AssertThat(out->level_cut_slack, Is().EqualTo(1u));
+        AssertThat(out->max_2level_cut[cut::Internal], Is().EqualTo(2u));
+      });
+
+      it("includes arcs out of the level below", [&]() {
+        // The diagram consists of the following nodes:
+        //
+        //   a0 = (a1, a2)                                              ---- x0
+        //   a1 = (b1, b2),  a2 = (b3, b4)                              ---- x1
+        //   b1 = (v, w1),   b2 = (v, w2),  b3 = (v, T),  b4 = (F, v)   ---- x2
+        //   v  = (F, T)                                                ---- x3
+        //   w1 = (d1, d2),  w2 = (d2, d1)                              ---- x4
+        //   d1 = (F, T),    d2 = (T, F)                                ---- x5
+        //
+        // The 2-level cut with v below and w1, w2 above is crossed by the four arcs into v and the
+        // four arcs out of w1 and w2. Yet, the arcs into, out of, and past x3 (or x4) are only 6.
+        const arc::uid_type a0(0, 0);
+        const arc::uid_type a1(1, 0);
+        const arc::uid_type a2(1, 1);
+        const arc::uid_type b1(2, 0);
+        const arc::uid_type b2(2, 1);
+        const arc::uid_type b3(2, 2);
+        const arc::uid_type b4(2, 3);
+        const arc::uid_type v(3, 0);
+        const arc::uid_type w1(4, 0);
+        const arc::uid_type w2(4, 1);
+        const arc::uid_type d1(5, 0);
+        const arc::uid_type d2(5, 1);
+
+        shared_levelized_file<arc> in;
+
+        { // Garbage collect writer to free write-lock
+          arc_ofstream aw(in);
+
+          aw.push_internal({ a0, false, a1 });
+          aw.push_internal({ a0, true, a2 });
+          aw.push_internal({ a1, false, b1 });
+          aw.push_internal({ a1, true, b2 });
+          aw.push_internal({ a2, false, b3 });
+          aw.push_internal({ a2, true, b4 });
+          aw.push_internal({ b1, false, v });
+          aw.push_internal({ b2, false, v });
+          aw.push_internal({ b3, false, v });
+          aw.push_internal({ b4, true, v });
+          aw.push_internal({ b1, true, w1 });
+          aw.push_internal({ b2, true, w2 });
+          aw.push_internal({ w1, false, d1 });
+          aw.push_internal({ w2, true, d1 });
+          aw.push_internal({ w1, true, d2 });
+          aw.push_internal({ w2, false, d2 });
+
+          aw.push_terminal({ b3, true, terminal_T });
+          aw.push_terminal({ b4, false, terminal_F });
+          aw.push_terminal({ v, false, terminal_F });
+          aw.push_terminal({ v, true, terminal_T });
+          aw.push_terminal({ d1, false, terminal_F });
+          aw.push_terminal({ d1, true, terminal_T });
+          aw.push_terminal({ d2, false, terminal_T });
+          aw.push_terminal({ d2, true, terminal_F });
+
+          aw.push(level_info(0, 1u));
+          aw.push(level_info(1, 2u));
+          aw.push(level_info(2, 4u));
+          aw.push(level_info(3, 1u));
+          aw.push(level_info(4, 2u));
+          aw.push(level_info(5, 2u));
+        }
+
+        in->max_1level_cut = 6;
+
+        // Reduce it
+        bdd out(__bdd(in, exec_policy()));
+
+        level_info_test_ifstream out_meta(out);
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        AssertThat(out_meta.pull().level(), Is().EqualTo(5u));
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        AssertThat(out_meta.pull().level(), Is().EqualTo(4u));
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        const level_info li_3 = out_meta.pull();
+        AssertThat(li_3.level(), Is().EqualTo(3u));
+        AssertThat(li_3.has_max_2level_cut(), Is().True());
+        AssertThat(li_3.max_2level_cut(), Is().GreaterThanOrEqualTo(8u));
+
+        AssertThat(out->level_cut_slack, Is().EqualTo(0u));
+        AssertThat(out->max_2level_cut[cut::Internal], Is().GreaterThanOrEqualTo(8u));
+      });
+    });
   });
 });
@@ -0,0 +1,163 @@
+#include "../../test.h"
+
+#include <adiar/internal/cut_profile.h>
+
+go_bandit([]() {
+  describe("adiar/internal/cut_profile.h", []() {
+    const ptr_uint64 false_ptr = ptr_uint64(false);
+    const ptr_uint64 true_ptr  = ptr_uint64(true);
+
+    /*
+    //          a          ---- x1
+    //         / \
+    //        b1 b2        ---- x3
+    //       / \ / \
+    //       |  F  |
+    //       \_ c _/       ---- x5
+    //         / \
+    //         F T
+    */
+    const node c(5, node::max_id, false_ptr, true_ptr);
+    const node b1(3, node::max_id, c.uid(), false_ptr);
+    const node b2(3, node::max_id - 1, false_ptr, c.uid());
+    const node a(1, node::max_id, b1.uid(), b2.uid());
+
+    const auto write = [&](shared_levelized_file<node>& nf,
+                           const bool all_cuts,
+                           const cut::size_type slack) {
+      node_ofstream nw(nf);
+      nw.unsafe_push(c);
+      nw.unsafe_push(b1);
+      nw.unsafe_push(b2);
+      nw.unsafe_push(a);
+
+      nw.unsafe_push(level_info(5, 1u, 2u));
+      nw.unsafe_push(all_cuts ? level_info(3, 2u, 4u) : level_info(3, 2u));
+      nw.unsafe_push(level_info(1, 1u, 2u));
+
+      nw.unsafe_set_1level_cut({ { 2u, 4u, 2u, 4u } });
+      nw.unsafe_inc_1level_cut({ { slack, slack, slack, slack } });
+    };
+
+    shared_levelized_file<node> nf;
+    write(nf, true, 0u);
+
+    shared_levelized_file<node> nf_slack;
+    write(nf_slack, true, 1u);
+
+    shared_levelized_file<node> nf_unknown;
+    write(nf_unknown, false, 0u);
+
+    const bdd f(nf);
+    const bdd f_slack(nf_slack);
+    const bdd f_unknown(nf_unknown);
+
+    it("has the global maximum i-level cuts as upper bounds", [&]() {
+      AssertThat(nf->max_1level_cut[cut::Internal], Is().EqualTo(2u));
+      AssertThat(nf->max_2level_cut[cut::Internal], Is().EqualTo(3u));
+    });
+
+    describe(".has_next(), .next_level()", [&]() {
+      it("provides all levels top-down", [&]() {
+        cut_profile p(f);
+
+        AssertThat(p.has_next(), Is().True());
+        AssertThat(p.next_level(), Is().EqualTo(1u));
+        p.seek(1u);
+
+        AssertThat(p.has_next(), Is().True());
+        AssertThat(p.next_level(), Is().EqualTo(3u));
+        p.seek(3u);
+
+        AssertThat(p.has_next(), Is().True());
+        AssertThat(p.next_level(), Is().EqualTo(5u));
+        p.seek(5u);
+
+        AssertThat(p.has_next(), Is().False());
+      });
+
+      it("skips levels when seeking past them", [&]() {
+        cut_profile p(f);
+        p.seek(4u);
+
+        AssertThat(p.has_next(), Is().True());
+        AssertThat(p.next_level(), Is().EqualTo(5u));
+      });
+    });
+
+    describe(".seek(l), .max_1level_cut(), .max_2level_cut()", [&]() {
+      it("is 0 above the root", [&]() {
+        cut_profile p(f);
+        p.seek(0u);
+
+        AssertThat(p.max_1level_cut(), Is().EqualTo(0u));
+        AssertThat(p.max_2level_cut(), Is().EqualTo(0u));
+      });
+
+      it("is the cut of each level clamped by the global maximum", [&]() {
+        cut_profile p(f);
+
+        p.seek(1u);
+        AssertThat(p.max_1level_cut(), Is().EqualTo(2u));
+        AssertThat(p.max_2level_cut(), Is().EqualTo(2u));
+
+        p.seek(3u);
+        AssertThat(p.max_1level_cut(), Is().EqualTo(2u));
+        AssertThat(p.max_2level_cut(), Is().EqualTo(3u));
+
+        p.seek(5u);
+        AssertThat(p.max_1level_cut(), Is().EqualTo(2u));
+        AssertThat(p.max_2level_cut(), Is().EqualTo(2u));
+      });
+
+      it("is the smallest cut of the surrounding levels in-between levels", [&]() {
+        cut_profile p(f);
+
+        p.seek(2u);
+        AssertThat(p.max_2level_cut(), Is().EqualTo(2u));
+
+        p.seek(4u);
+        AssertThat(p.max_2level_cut(), Is().EqualTo(2u));
+      });
+
+      it("is 0 below the last level", [&]() {
+        cut_profile p(f);
+        p.seek(6u);
+
+        AssertThat(p.max_1level_cut(), Is().EqualTo(0u));
+        AssertThat(p.max_2level_cut(), Is().EqualTo(0u));
+      });
+
+      it("includes the slack", [&]() {
+        cut_profile p(f_slack);
+
+        p.seek(0u);
+        AssertThat(p.max_2level_cut(), Is().EqualTo(1u));
+
+        p.seek(1u);
+        AssertThat(p.max_2level_cut(), Is().EqualTo(3u));
+
+        p.seek(3u);
+        AssertThat(p.max_1level_cut(), Is().EqualTo(3u));
+        AssertThat(p.max_2level_cut(), Is().EqualTo(4u));
+
+        p.seek(6u);
+        AssertThat(p.max_2level_cut(), Is().EqualTo(1u));
+      });
+
+      it("uses the global maximum for levels without a known cut", [&]() {
+        cut_profile p(f_unknown);
+
+        p.seek(2u);
+        AssertThat(p.max_2level_cut(), Is().EqualTo(2u));
+
+        p.seek(3u);
+        AssertThat(p.max_1level_cut(), Is().EqualTo(2u));
+        AssertThat(p.max_2level_cut(), Is().EqualTo(3u));
+
+        p.seek(4u);
+        AssertThat(p.max_2level_cut(), Is().EqualTo(2u));
+      });
+    });
+  });
+});
@@ -0,0 +1,77 @@
+#include "../../../test.h"
+
+#include <thread>
+
+#include <adiar/internal/data_structures/buffer_pool.h>
+#include <adiar/internal/data_structures/sorter.h>
+
+go_bandit([]() {
+  describe("adiar/internal/data_structures/buffer_pool.h", []() {
+    using test_sorter = sorter<memory_mode::Internal, int>;
+
+    const size_t memory_bytes = test_sorter::memory_usage(1024u);
+
+    it("is empty after being cleared", []() {
+      buffer_pool_clear();
+      AssertThat(buffer_pool_size(), Is().EqualTo(0u));
+    });
+
+    it("keeps the buffer of a destructed sorter", [&]() {
+      buffer_pool_clear();
+      const size_t used_before = memory_used();
+      { test_sorter s(memory_bytes, 1024u); }
+
+      AssertThat(buffer_pool_size(), Is().EqualTo(tpie::array<int>::memory_usage(1024u)));
+      AssertThat(memory_used(), Is().GreaterThan(used_before));
+    });
+
+    it("does not give a much larger buffer to a small sorter", [&]() {
+      buffer_pool_clear();
+      { test_sorter s(memory_bytes, 1024u); }
+
+      const size_t size_before = buffer_pool_size();
+      { test_sorter s(memory_bytes, 128u); }
+
+      AssertThat(buffer_pool_size(), Is().GreaterThan(size_before));
+    });
+
+    it("gives a kept buffer to a sorter of a similar size", [&]() {
+      buffer_pool_clear();
+      { test_sorter s(memory_bytes, 1024u); }
+
+      test_sorter s(memory_bytes, 1000u);
+      AssertThat(buffer_pool_size(), Is().EqualTo(0u));
+    });
+
+    it("only lets a sorter with a reused buffer hold as many elements as it asked for", [&]() {
+      buffer_pool_clear();
+      { test_sorter s(memory_bytes, 1024u); }
+
+      test_sorter s(memory_bytes, 600u);
+      AssertThat(buffer_pool_size(), Is().EqualTo(0u));
+
+      for (int i = 0; i < 600; ++i) { s.push(i); }
+      AssertThat(s.can_push(), Is().False());
+    });
+
+    it("frees all buffers when cleared", [&]() {
+      { test_sorter s(memory_bytes, 1024u); }
+      const size_t used_before = memory_used();
+
+      buffer_pool_clear();
+      AssertThat(buffer_pool_size(), Is().EqualTo(0u));
+      AssertThat(memory_used(), Is().LessThan(used_before));
+    });
+
+    it("frees the buffers released by another thread when cleared", [&]() {
+      buffer_pool_clear();
+
+      std::thread t([&]() { test_sorter s(memory_bytes, 1024u); });
+      t.join();
+      AssertThat(buffer_pool_size(), Is().EqualTo(tpie::array<int>::memory_usage(1024u)));
+
+      buffer_pool_clear();
+      AssertThat(buffer_pool_size(), Is().EqualTo(0u));
+    });
+  });
+});
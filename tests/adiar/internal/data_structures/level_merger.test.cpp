@@ -45,6 +45,27 @@ go_bandit([]() {
          << node(0, node::max_id, node::pointer_type(2, node::max_id), terminal_T);
     }
 
+    shared_levelized_file<dd::node_type> nf_x0_or_x2_cut;
+    /*
+    //           1     ---- x0    (cut: 1)
+    //          / \
+    //          | T
+    //          |
+    //          2      ---- x2    (cut: 1)
+    //         / \
+    //         F T
+    */
+    {
+      node_ofstream nw(nf_x0_or_x2_cut);
+      nw.unsafe_push(node(2, node::max_id, terminal_F, terminal_T));
+      nw.unsafe_push(node(0, node::max_id, node::pointer_type(2, node::max_id), terminal_T));
+
+      nw.unsafe_push(level_info(2, 1u, 1u));
+      nw.unsafe_push(level_info(0, 1u, 1u));
+
+      nw.unsafe_set_1level_cut({ { 1u, 2u, 2u, 3u } });
+    }
+
     describe("level_merger(dd ...)", [&]() {
       it("can pull from a single diagram [x0]", [&]() {
         level_merger<std::less<>, 1> merger({ dd(nf_x0) });
@@ -534,5 +555,91 @@ go_bandit([]() {
         AssertThat(merger.can_pull(), Is().False());
       });
     });
+
+    describe("level_merger::peek_width()", [&]() {
+      it("provides the width of a single diagram's levels [x0 | x2]", [&]() {
+        level_merger<std::less<>, 1> merger({ dd(nf_x0_or_x2) });
+
+        AssertThat(merger.peek_width(), Is().EqualTo(1u));
+        AssertThat(merger.pull(), Is().EqualTo(0u));
+
+        AssertThat(merger.peek_width(), Is().EqualTo(1u));
+        AssertThat(merger.pull(), Is().EqualTo(2u));
+      });
+
+      it("sums the widths of two diagrams [x0, x0 | x2]", [&]() {
+        level_merger<std::less<>, 2> merger({ dd(nf_x0), dd(nf_x0_or_x2) });
+
+        AssertThat(merger.peek_width(), Is().EqualTo(2u));
+        AssertThat(merger.pull(), Is().EqualTo(0u));
+
+        AssertThat(merger.peek_width(), Is().EqualTo(1u));
+        AssertThat(merger.pull(), Is().EqualTo(2u));
+      });
+
+      it("has width 0 for generators [1,2] + [x0 | x2]", [&]() {
+        const std::vector<int> xs = { 1, 2 };
+
+        level_merger<std::less<>, 2> merger(
+          { make_generator(xs.begin(), xs.end()), dd(nf_x0_or_x2) });
+
+        AssertThat(merger.peek_width(), Is().EqualTo(1u));
+        AssertThat(merger.pull(), Is().EqualTo(0u));
+
+        AssertThat(merger.peek_width(), Is().EqualTo(0u));
+        AssertThat(merger.pull(), Is().EqualTo(1u));
+
+        AssertThat(merger.peek_width(), Is().EqualTo(1u));
+        AssertThat(merger.pull(), Is().EqualTo(2u));
+      });
+    });
+
+    describe("level_merger::peek_cut()", [&]() {
+      it("provides the cut of a single diagram's levels [x0 | x2]", [&]() {
+        level_merger<std::less<>, 1> merger({ dd(nf_x0_or_x2_cut) });
+
+        AssertThat(merger.peek_cut(), Is().EqualTo(1u));
+        AssertThat(merger.pull(), Is().EqualTo(0u));
+
+        AssertThat(merger.peek_cut(), Is().EqualTo(1u));
+        AssertThat(merger.pull(), Is().EqualTo(2u));
+      });
+
+      it("sums the cuts of two diagrams [x0 | x2, x0 | x2]", [&]() {
+        level_merger<std::less<>, 2> merger({ dd(nf_x0_or_x2_cut), dd(nf_x0_or_x2_cut) });
+
+        AssertThat(merger.peek_cut(), Is().EqualTo(2u));
+        AssertThat(merger.pull(), Is().EqualTo(0u));
+
+        AssertThat(merger.peek_cut(), Is().EqualTo(2u));
+        AssertThat(merger.pull(), Is().EqualTo(2u));
+      });
+
+      it("is 0 if the cut is unknown in one of the diagrams [x0, x0 | x2]", [&]() {
+        level_merger<std::less<>, 2> merger({ dd(nf_x0), dd(nf_x0_or_x2_cut) });
+
+        AssertThat(merger.peek_cut(), Is().EqualTo(0u));
+        AssertThat(merger.pull(), Is().EqualTo(0u));
+
+        AssertThat(merger.peek_cut(), Is().EqualTo(1u));
+        AssertThat(merger.pull(), Is().EqualTo(2u));
+      });
+
+      it("has cut 0 for generators [1,2] + [x0 | x2]", [&]() {
+        const std::vector<int> xs = { 1, 2 };
+
+        level_merger<std::less<>, 2> merger(
+          { make_generator(xs.begin(), xs.end()), dd(nf_x0_or_x2_cut) });
+
+        AssertThat(merger.peek_cut(), Is().EqualTo(1u));
+        AssertThat(merger.pull(), Is().EqualTo(0u));
+
+        AssertThat(merger.peek_cut(), Is().EqualTo(0u));
+        AssertThat(merger.pull(), Is().EqualTo(1u));
+
+        AssertThat(merger.peek_cut(), Is().EqualTo(0u));
+        AssertThat(merger.pull(), Is().EqualTo(2u));
+      });
+    });
   });
 });
@@ -5343,5 +5343,146 @@ go_bandit([]() {
         });
       });
     });
+
+    describe("levelized_priority_queue<..., memory_mode::Hybrid, ...>", []() {
+      using hybrid_priority_queue = levelized_priority_queue<lpq_test_data,
+                                                             lpq_test_lt,
+                                                             2u,
+                                                             memory_mode::Hybrid,
+                                                             1u,
+                                                             std::less<>,
+                                                             1u>;
+
+      it("can push into and pull from buckets of skewed levels", []() {
+        lpq_test_file f;
+
+        { // Garbage collect the writer early
+          lpq_test_ofstream fw(f);
+
+          fw.push(level_info(1, 1u));  // skipped
+          fw.push(level_info(2, 1u));  // bucket
+          fw.push(level_info(3, 64u)); // bucket
+          fw.push(level_info(4, 1u));  // bucket
+          fw.push(level_info(5, 1u));  // overflow
+        }
+
+        hybrid_priority_queue pq({ f }, memory_available(), 8, stats_lpq_tests);
+
+        for (uint64_t n = 16; 0 < n; --n) { pq.push(lpq_test_data{ 3, n }); }
+        pq.push(lpq_test_data{ 2, 1 });
+        pq.push(lpq_test_data{ 5, 1 });
+        AssertThat(pq.size(), Is().EqualTo(18u));
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(2u));
+        AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 2, 1 }));
+        AssertThat(pq.can_pull(), Is().False());
+
+        pq.push(lpq_test_data{ 4, 1 });
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(3u));
+        for (uint64_t n = 1; n <= 16; ++n) {
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 3, n }));
+        }
+        AssertThat(pq.can_pull(), Is().False());
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(4u));
+        AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 4, 1 }));
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(5u));
+        AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 5, 1 }));
+
+        AssertThat(pq.can_pull(), Is().False());
+        AssertThat(pq.size(), Is().EqualTo(0u));
+      });
+
+      it("can relabel buckets of levels without any elements", []() {
+        lpq_test_file f;
+
+        { // Garbage collect the writer early
+          lpq_test_ofstream fw(f);
+
+          fw.push(level_info(1, 1u));  // skipped
+          fw.push(level_info(2, 2u));  // bucket
+          fw.push(level_info(3, 2u));  // bucket
+          fw.push(level_info(4, 32u)); // bucket
+          fw.push(level_info(5, 32u)); // .
+          fw.push(level_info(6, 1u));  // .
+        }
+
+        hybrid_priority_queue pq({ f }, memory_available(), 8, stats_lpq_tests);
+
+        pq.push(lpq_test_data{ 5, 2 });
+        pq.push(lpq_test_data{ 5, 1 });
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(5u));
+
+        AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 5, 1 }));
+
+        for (uint64_t n = 12; 0 < n; --n) { pq.push(lpq_test_data{ 6, n }); }
+
+        AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 5, 2 }));
+        AssertThat(pq.can_pull(), Is().False());
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(6u));
+        for (uint64_t n = 1; n <= 12; ++n) {
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 6, n }));
+        }
+        AssertThat(pq.can_pull(), Is().False());
+      });
+
+      it("can push into and pull from buckets of levels with a large cut", []() {
+        lpq_test_file f;
+
+        { // Garbage collect the writer early
+          lpq_test_ofstream fw(f);
+
+          fw.push(level_info(1, 1u, 1u));         // skipped
+          fw.push(level_info(2, 1u, 1u));         // bucket
+          fw.push(level_info(3, 64u, 1u << 30u)); // bucket (external)
+          fw.push(level_info(4, 1u, 2u));         // bucket
+          fw.push(level_info(5, 1u, 1u << 30u));  // overflow
+        }
+
+        hybrid_priority_queue pq({ f }, memory_available(), 1u << 30u, stats_lpq_tests);
+
+        for (uint64_t n = 16; 0 < n; --n) { pq.push(lpq_test_data{ 3, n }); }
+        pq.push(lpq_test_data{ 2, 1 });
+        pq.push(lpq_test_data{ 5, 1 });
+        AssertThat(pq.size(), Is().EqualTo(18u));
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(2u));
+        AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 2, 1 }));
+        AssertThat(pq.can_pull(), Is().False());
+
+        pq.push(lpq_test_data{ 4, 1 });
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(3u));
+        for (uint64_t n = 1; n <= 16; ++n) {
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 3, n }));
+        }
+        AssertThat(pq.can_pull(), Is().False());
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(4u));
+        AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 4, 1 }));
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(5u));
+        AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 5, 1 }));
+
+        AssertThat(pq.can_pull(), Is().False());
+        AssertThat(pq.size(), Is().EqualTo(0u));
+      });
+    });
   });
 });
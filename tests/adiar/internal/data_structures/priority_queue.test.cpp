@@ -2,6 +2,46 @@
 
 #include <adiar/internal/data_structures/priority_queue.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+// Comparator on (non-negative) integers that is a plain key extraction.
+struct radix_heap_test_lt
+{
+  static constexpr size_t radix_words = 1u;
+
+  static uint64_t
+  radix_key(const int& x, size_t /*w*/)
+  {
+    return static_cast<uint64_t>(x);
+  }
+
+  bool
+  operator()(const int& a, const int& b) const
+  {
+    return a < b;
+  }
+};
+
+// Comparator on (key, payload) pairs that only looks at the (non-negative) key.
+struct radix_heap_test_key_lt
+{
+  static constexpr size_t radix_words = 1u;
+
+  static uint64_t
+  radix_key(const std::pair<int, int>& x, size_t /*w*/)
+  {
+    return static_cast<uint64_t>(x.first);
+  }
+
+  bool
+  operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const
+  {
+    return a.first < b.first;
+  }
+};
+
 go_bandit([]() {
   describe("adiar/internal/priority_queue.h", []() {
     describe("priority_queue<memory_mode::Internal, int, std::less<>>", []() {
@@ -319,5 +359,232 @@ go_bandit([]() {
         AssertThat(pq.size(), Is().EqualTo(0u));
       });
     });
+
+    describe("priority_queue<memory_mode::Hybrid, int, std::less<>>", []() {
+      it("stays in internal memory if elements fit", []() {
+        priority_queue<memory_mode::Hybrid, int, std::less<>> pq(8 * 1024 * 1024, 16);
+
+        pq.push(3);
+        pq.push(1);
+        pq.push(2);
+        AssertThat(pq.spilled(), Is().False());
+        AssertThat(pq.size(), Is().EqualTo(3u));
+
+        AssertThat(pq.top(), Is().EqualTo(1));
+        pq.pop();
+        AssertThat(pq.top(), Is().EqualTo(2));
+        pq.pop();
+        AssertThat(pq.top(), Is().EqualTo(3));
+        pq.pop();
+        AssertThat(pq.has_top(), Is().False());
+      });
+
+      it("spills to external memory when exceeding its capacity", []() {
+        priority_queue<memory_mode::Hybrid, int, std::less<>> pq(8 * 1024 * 1024, 4);
+
+        for (int i = 0; i < 4; ++i) { pq.push((7 * i) % 10); }
+        AssertThat(pq.spilled(), Is().False());
+        AssertThat(pq.top(), Is().EqualTo(0));
+
+        for (int i = 4; i < 10; ++i) { pq.push((7 * i) % 10); }
+        AssertThat(pq.spilled(), Is().True());
+        AssertThat(pq.size(), Is().EqualTo(10u));
+
+        for (int i = 0; i < 10; ++i) {
+          AssertThat(pq.has_top(), Is().True());
+          AssertThat(pq.top(), Is().EqualTo(i));
+          pq.pop();
+        }
+        AssertThat(pq.empty(), Is().True());
+      });
+    });
+
+    describe("radix_heap<int, radix_heap_test_lt>", []() {
+      it("is the monotone priority queue for comparators with a radix key", []() {
+        AssertThat((std::is_same_v<monotone_priority_queue<memory_mode::Internal,
+                                                           int,
+                                                           radix_heap_test_lt>,
+                                   radix_heap<int, radix_heap_test_lt>>),
+                   Is().True());
+
+        AssertThat((std::is_same_v<monotone_priority_queue<memory_mode::Internal, int>,
+                                   priority_queue<memory_mode::Internal, int>>),
+                   Is().True());
+      });
+
+      it("is initially empty", []() {
+        radix_heap<int, radix_heap_test_lt> pq(1024 * 1024, 16);
+
+        AssertThat(pq.empty(), Is().True());
+        AssertThat(pq.size(), Is().EqualTo(0u));
+        AssertThat(pq.has_top(), Is().False());
+      });
+
+      it("can push and pop elements", []() {
+        radix_heap<int, radix_heap_test_lt> pq(1024 * 1024, 16);
+
+        pq.push(3);
+        pq.push(1);
+        pq.push(4);
+        AssertThat(pq.size(), Is().EqualTo(3u));
+        AssertThat(pq.top(), Is().EqualTo(1));
+
+        pq.pop();
+        AssertThat(pq.top(), Is().EqualTo(3));
+
+        pq.push(4);
+        pq.push(3);
+        AssertThat(pq.top(), Is().EqualTo(3));
+        AssertThat(pq.size(), Is().EqualTo(4u));
+
+        pq.pop();
+        AssertThat(pq.top(), Is().EqualTo(3));
+        pq.pop();
+        AssertThat(pq.top(), Is().EqualTo(4));
+        pq.pop();
+        AssertThat(pq.top(), Is().EqualTo(4));
+        pq.pop();
+
+        AssertThat(pq.empty(), Is().True());
+      });
+
+      it("updates the top element on pushing a smaller one", []() {
+        radix_heap<int, radix_heap_test_lt> pq(1024 * 1024, 16);
+
+        pq.push(42);
+        AssertThat(pq.top(), Is().EqualTo(42));
+
+        pq.push(8);
+        AssertThat(pq.top(), Is().EqualTo(8));
+
+        pq.push(21);
+        AssertThat(pq.top(), Is().EqualTo(8));
+      });
+
+      it("forgets the top element of a later bucket on pushing one with the last key", []() {
+        radix_heap<int, radix_heap_test_lt> pq(1024 * 1024, 16);
+
+        pq.push(5);
+        pq.push(6);
+        AssertThat(pq.top(), Is().EqualTo(5));
+
+        pq.push(0);
+        AssertThat(pq.top(), Is().EqualTo(0));
+
+        pq.pop();
+        AssertThat(pq.size(), Is().EqualTo(2u));
+        AssertThat(pq.top(), Is().EqualTo(5));
+
+        pq.push(7);
+        AssertThat(pq.top(), Is().EqualTo(5));
+        pq.pop();
+        AssertThat(pq.top(), Is().EqualTo(6));
+        pq.pop();
+        AssertThat(pq.top(), Is().EqualTo(7));
+        pq.pop();
+        AssertThat(pq.empty(), Is().True());
+      });
+
+      it("pops the top element among equal keys with different payloads", []() {
+        using pq_t = radix_heap<std::pair<int, int>, radix_heap_test_key_lt>;
+        pq_t pq(pq_t::memory_usage(64), 64);
+
+        // More elements than fit in a single chunk of a bucket.
+        std::vector<int> pushed;
+        for (int i = 0; i < 40; ++i) {
+          pq.push({ 1 + i % 2, i });
+          pushed.push_back(i);
+        }
+
+        std::vector<int> popped;
+        int last_key = 0;
+        while (!pq.empty()) {
+          const std::pair<int, int> top = pq.top();
+          AssertThat(top.first, Is().GreaterThanOrEqualTo(last_key));
+          AssertThat(pq.top().second, Is().EqualTo(top.second));
+
+          // Pushes with the same key do not change the top element.
+          if (top.second < 40 && top.second % 4 == 0) {
+            pq.push({ top.first, 100 + top.second });
+            pushed.push_back(100 + top.second);
+          }
+
+          pq.pop();
+          popped.push_back(top.second);
+          last_key = top.first;
+        }
+
+        std::sort(pushed.begin(), pushed.end());
+        std::sort(popped.begin(), popped.end());
+        AssertThat(popped.size(), Is().EqualTo(pushed.size()));
+        for (size_t i = 0; i < pushed.size(); ++i) {
+          AssertThat(popped[i], Is().EqualTo(pushed[i]));
+        }
+      });
+
+      it("pops the top element among equal keys after pushing a smaller one", []() {
+        using pq_t = radix_heap<std::pair<int, int>, radix_heap_test_key_lt>;
+        pq_t pq(pq_t::memory_usage(16), 16);
+
+        pq.push({ 8, 0 });
+        pq.push({ 8, 1 });
+        AssertThat(pq.top().first, Is().EqualTo(8));
+
+        pq.push({ 4, 2 });
+        pq.push({ 4, 3 });
+        pq.push({ 8, 4 });
+
+        std::vector<int> popped;
+        while (!pq.empty()) {
+          const std::pair<int, int> top = pq.top();
+          pq.pop();
+          popped.push_back(top.second);
+        }
+        AssertThat(popped.size(), Is().EqualTo(5u));
+
+        std::sort(popped.begin(), popped.begin() + 2);
+        std::sort(popped.begin() + 2, popped.end());
+
+        const std::vector<int> expected = { 2, 3, 0, 1, 4 };
+        for (size_t i = 0; i < expected.size(); ++i) {
+          AssertThat(popped[i], Is().EqualTo(expected[i]));
+        }
+      });
+
+      it("can interleave many monotone pushes and pops", []() {
+        constexpr size_t max_size = 2000;
+        radix_heap<int, radix_heap_test_lt> pq(
+          radix_heap<int, radix_heap_test_lt>::memory_usage(max_size), max_size);
+
+        std::vector<int> expected;
+        int last = 0;
+
+        for (int i = 0; i < 1000; ++i) { pq.push((i * 7919) % 1000); }
+        for (int i = 0; i < 1000; ++i) { expected.push_back((i * 7919) % 1000); }
+
+        for (int round = 0; round < 1000; ++round) {
+          std::sort(expected.begin(), expected.end(), std::greater<>());
+
+          AssertThat(pq.size(), Is().EqualTo(expected.size()));
+          AssertThat(pq.top(), Is().EqualTo(expected.back()));
+
+          last = pq.top();
+          pq.pop();
+          expected.pop_back();
+
+          const int x = last + (round * 31) % 97;
+          pq.push(x);
+          expected.push_back(x);
+        }
+
+        std::sort(expected.begin(), expected.end(), std::greater<>());
+        while (!expected.empty()) {
+          AssertThat(pq.top(), Is().EqualTo(expected.back()));
+          pq.pop();
+          expected.pop_back();
+        }
+        AssertThat(pq.empty(), Is().True());
+      });
+    });
   });
 });
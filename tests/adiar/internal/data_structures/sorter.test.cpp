@@ -1,6 +1,11 @@
 #include "../../../test.h"
 
+#include <algorithm>
+#include <vector>
+
+#include <adiar/internal/data_structures/radix_sort.h>
 #include <adiar/internal/data_structures/sorter.h>
+#include <adiar/internal/data_types/arc.h>
 
 go_bandit([]() {
   describe("adiar/internal/sorter.h", []() {
@@ -295,5 +300,250 @@ go_bandit([]() {
         AssertThat(s.pull(), Is().EqualTo(1));
       });
     });
+
+    describe("sorter<memory_mode::Hybrid, int, std::less<>>", []() {
+      it("stays in internal memory if elements fit", []() {
+        sorter<memory_mode::Hybrid, int, std::less<>> s(8 * 1024 * 1024, 16);
+
+        s.push(3);
+        s.push(1);
+        s.push(2);
+        AssertThat(s.spilled(), Is().False());
+        AssertThat(s.size(), Is().EqualTo(3u));
+
+        s.sort();
+        AssertThat(s.pull(), Is().EqualTo(1));
+        AssertThat(s.top(), Is().EqualTo(2));
+        AssertThat(s.pull(), Is().EqualTo(2));
+        AssertThat(s.pull(), Is().EqualTo(3));
+        AssertThat(s.can_pull(), Is().False());
+      });
+
+      it("spills to external memory when exceeding its capacity", []() {
+        sorter<memory_mode::Hybrid, int, std::less<>> s(8 * 1024 * 1024, 4);
+
+        for (int i = 0; i < 4; ++i) { s.push((7 * i) % 10); }
+        AssertThat(s.spilled(), Is().False());
+
+        for (int i = 4; i < 10; ++i) { s.push((7 * i) % 10); }
+        AssertThat(s.spilled(), Is().True());
+        AssertThat(s.size(), Is().EqualTo(10u));
+
+        s.sort();
+        for (int i = 0; i < 10; ++i) {
+          AssertThat(s.can_pull(), Is().True());
+          AssertThat(s.top(), Is().EqualTo(i));
+          AssertThat(s.pull(), Is().EqualTo(i));
+        }
+        AssertThat(s.can_pull(), Is().False());
+        AssertThat(s.empty(), Is().True());
+      });
+
+      it("is reset to internal memory by 'reset_unique'", []() {
+        using sorter_t = sorter<memory_mode::Hybrid, int, std::less<>>;
+        unique_ptr<sorter_t> s = sorter_t::make_unique(8 * 1024 * 1024, 2);
+
+        s->push(2);
+        s->push(1);
+        s->push(0);
+        AssertThat(s->spilled(), Is().True());
+
+        sorter_t::reset_unique(s, 8 * 1024 * 1024, 2);
+        AssertThat(s->spilled(), Is().False());
+        AssertThat(s->empty(), Is().True());
+
+        s->push(1);
+        s->push(0);
+        s->sort();
+        AssertThat(s->pull(), Is().EqualTo(0));
+        AssertThat(s->pull(), Is().EqualTo(1));
+      });
+
+      it("is resized by 'reset_unique' for more elements", []() {
+        using sorter_t = sorter<memory_mode::Hybrid, int, std::less<>>;
+        unique_ptr<sorter_t> s = sorter_t::make_unique(8 * 1024 * 1024, 2);
+
+        s->push(1);
+        s->push(0);
+        AssertThat(s->spilled(), Is().False());
+
+        sorter_t::reset_unique(s, 8 * 1024 * 1024, 4);
+
+        s->push(3);
+        s->push(1);
+        s->push(2);
+        s->push(0);
+        AssertThat(s->spilled(), Is().False());
+
+        s->sort();
+        for (int i = 0; i < 4; ++i) { AssertThat(s->pull(), Is().EqualTo(i)); }
+        AssertThat(s->can_pull(), Is().False());
+      });
+
+      it("merges its sorted run with the elements pushed after spilling", []() {
+        sorter<memory_mode::Hybrid, int, std::less<>> s(8 * 1024 * 1024, 3);
+
+        s.push(4);
+        s.push(0);
+        s.push(2);
+        AssertThat(s.spilled(), Is().False());
+
+        s.push(3);
+        s.push(1);
+        s.push(2);
+        AssertThat(s.spilled(), Is().True());
+        AssertThat(s.size(), Is().EqualTo(6u));
+
+        s.sort();
+        const int expected[] = { 0, 1, 2, 2, 3, 4 };
+        for (int i = 0; i < 6; ++i) {
+          AssertThat(s.size(), Is().EqualTo(6u - i));
+          AssertThat(s.top(), Is().EqualTo(expected[i]));
+          AssertThat(s.pull(), Is().EqualTo(expected[i]));
+        }
+        AssertThat(s.can_pull(), Is().False());
+        AssertThat(s.empty(), Is().True());
+      });
+
+      it("starts out in external memory without any budget for its internal buffer", []() {
+        using sorter_t = sorter<memory_mode::Hybrid, int, std::less<>>;
+        unique_ptr<sorter_t> s = sorter_t::make_unique_with_budget(0u, 8 * 1024 * 1024, 16);
+        AssertThat(s->spilled(), Is().True());
+        AssertThat(s->empty(), Is().True());
+
+        s->push(2);
+        s->push(0);
+        s->push(1);
+        AssertThat(s->size(), Is().EqualTo(3u));
+
+        s->sort();
+        AssertThat(s->pull(), Is().EqualTo(0));
+        AssertThat(s->pull(), Is().EqualTo(1));
+        AssertThat(s->pull(), Is().EqualTo(2));
+        AssertThat(s->can_pull(), Is().False());
+
+        sorter_t::reset_unique_with_budget(s, 8 * 1024 * 1024, 8 * 1024 * 1024, 16);
+        AssertThat(s->spilled(), Is().False());
+        AssertThat(s->empty(), Is().True());
+      });
+
+      it("only uses its share of the memory after spilling", []() {
+        using sorter_t = sorter<memory_mode::Hybrid, int, std::less<>>;
+
+        const size_t no_sorters   = 4u;
+        const size_t memory_bytes = no_sorters * 32 * 1024 * 1024;
+        const size_t share        = memory_bytes / no_sorters;
+
+        const size_t used_before = memory_used();
+        size_t used_peak         = used_before;
+
+        {
+          sorter_t s(memory_bytes, 16, no_sorters);
+
+          for (int i = 0; i < 64 * 1024; ++i) {
+            s.push((7 * i) % (64 * 1024));
+            used_peak = std::max(used_peak, memory_used());
+          }
+          AssertThat(s.spilled(), Is().True());
+
+          s.sort();
+          used_peak = std::max(used_peak, memory_used());
+
+          for (int i = 0; i < 64 * 1024; ++i) {
+            AssertThat(s.pull(), Is().EqualTo(i));
+            used_peak = std::max(used_peak, memory_used());
+          }
+        }
+        AssertThat(used_peak - used_before, Is().LessThanOrEqualTo(share));
+      });
+
+      it("only uses its share of the memory when starting out in external memory", []() {
+        using sorter_t = sorter<memory_mode::Hybrid, int, std::less<>>;
+
+        const size_t no_sorters   = 4u;
+        const size_t memory_bytes = no_sorters * 32 * 1024 * 1024;
+        const size_t share        = memory_bytes / no_sorters;
+
+        const size_t used_before = memory_used();
+        size_t used_peak         = used_before;
+
+        {
+          unique_ptr<sorter_t> s =
+            sorter_t::make_unique_with_budget(0u, memory_bytes, 64 * 1024, no_sorters);
+
+          for (int i = 0; i < 64 * 1024; ++i) {
+            s->push((7 * i) % (64 * 1024));
+            used_peak = std::max(used_peak, memory_used());
+          }
+
+          s->sort();
+          used_peak = std::max(used_peak, memory_used());
+
+          for (int i = 0; i < 64 * 1024; ++i) {
+            AssertThat(s->pull(), Is().EqualTo(i));
+            used_peak = std::max(used_peak, memory_used());
+          }
+        }
+        AssertThat(used_peak - used_before, Is().LessThanOrEqualTo(share));
+      });
+    });
+
+    describe("sorter<memory_mode::Internal, arc, arc_source_lt> [radix sort]", []() {
+      // Enough elements to use the radix sort rather than TPIE's parallel sort.
+      const size_t size = 4u * radix_sort_threshold;
+
+      // Pseudo-random arcs over a few levels with ids that vary in their lower and upper bytes.
+      std::vector<arc> arcs;
+      for (size_t i = 0; i < size; ++i) {
+        const size_t r = (i * 2654435761u) % 1000003u;
+
+        const ptr_uint64 source(r % 3u, (r / 3u) % 4096u, r % 2u);
+        const ptr_uint64 target(4u, i);
+
+        arcs.push_back(arc(source, target));
+      }
+
+      it("is used for 'arc_source_lt'", [&]() {
+        AssertThat(has_radix_key_v<arc_source_lt, arc>, Is().True());
+      });
+
+      it("is not used for 'std::less<int>'", [&]() {
+        AssertThat(has_radix_key_v<std::less<int>, int>, Is().False());
+      });
+
+      it("sorts elements", [&]() {
+        sorter<memory_mode::Internal, arc, arc_source_lt> s(
+          sorter<memory_mode::Internal, arc, arc_source_lt>::memory_usage(size), size);
+
+        for (const arc& a : arcs) { s.push(a); }
+        s.sort();
+
+        std::vector<arc> expected = arcs;
+        std::stable_sort(expected.begin(), expected.end(), arc_source_lt());
+
+        for (const arc& e : expected) {
+          AssertThat(s.can_pull(), Is().True());
+          AssertThat(s.pull().source(), Is().EqualTo(e.source()));
+        }
+        AssertThat(s.can_pull(), Is().False());
+      });
+
+      it("sorts on multi-word keys [arc_target_lt]", [&]() {
+        std::vector<arc> in = arcs;
+        std::reverse(in.begin(), in.end());
+        for (size_t i = 0; i < in.size(); ++i) {
+          in[i] = arc(ptr_uint64(4u, i % 7u), in[i].source());
+        }
+
+        std::vector<arc> expected = in;
+        std::sort(expected.begin(), expected.end(), arc_target_lt());
+
+        radix_sort<arc_target_lt>(in.begin(), in.end());
+
+        for (size_t i = 0; i < in.size(); ++i) {
+          AssertThat(in[i].target(), Is().EqualTo(expected[i].target()));
+        }
+      });
+    });
   });
 });
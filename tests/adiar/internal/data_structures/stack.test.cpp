@@ -53,7 +53,57 @@ go_bandit([]() {
     });
 
     describe("stack<memory_mode::External, int>", []() {
-      // TODO: Add tests when implemented.
+      stack<memory_mode::External, int> s(16);
+
+      it("is initially empty", [&s]() {
+        AssertThat(s.empty(), Is().True());
+        AssertThat(s.size(), Is().EqualTo(0u));
+      });
+
+      it("can push elements", [&s]() {
+        s.push(3);
+        s.push(1);
+        s.push(2);
+
+        AssertThat(s.empty(), Is().False());
+        AssertThat(s.size(), Is().EqualTo(3u));
+      });
+
+      it("can top latest element", [&s]() {
+        AssertThat(s.top(), Is().EqualTo(2));
+        AssertThat(s.size(), Is().EqualTo(3u));
+      });
+
+      it("can pull latest element", [&s]() {
+        AssertThat(s.pull(), Is().EqualTo(2));
+        AssertThat(s.size(), Is().EqualTo(2u));
+      });
+
+      it("can push a new element", [&s]() {
+        s.push(4);
+        AssertThat(s.top(), Is().EqualTo(4));
+        AssertThat(s.size(), Is().EqualTo(3u));
+      });
+
+      it("can pop an element", [&s]() {
+        s.pop();
+        AssertThat(s.top(), Is().EqualTo(1));
+        AssertThat(s.size(), Is().EqualTo(2u));
+      });
+
+      it("can be cleared", [&s]() {
+        s.clear();
+        AssertThat(s.empty(), Is().True());
+        AssertThat(s.size(), Is().EqualTo(0u));
+      });
+
+      it("can push and pull more elements than its given capacity", [&s]() {
+        for (int i = 0; i < 100000; ++i) { s.push(i); }
+        AssertThat(s.size(), Is().EqualTo(100000u));
+
+        for (int i = 100000; 0 < i; --i) { AssertThat(s.pull(), Is().EqualTo(i - 1)); }
+        AssertThat(s.empty(), Is().True());
+      });
     });
   });
 });
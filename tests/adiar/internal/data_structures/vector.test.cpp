@@ -81,7 +81,92 @@ go_bandit([]() {
     });
 
     describe("vector<memory_mode::External, int>", []() {
-      // TODO: Add tests when implemented.
+      vector<memory_mode::External, int> v;
+
+      it("is initially empty", [&v]() {
+        AssertThat(v.empty(), Is().True());
+        AssertThat(v.size(), Is().EqualTo(0u));
+      });
+
+      it("can push elements", [&v]() {
+        v.push_back(3);
+        v.push_back(1);
+        v.push_back(2);
+
+        AssertThat(v.empty(), Is().False());
+        AssertThat(v.size(), Is().EqualTo(3u));
+      });
+
+      it("can retrieve the front element", [&v]() { AssertThat(v.front(), Is().EqualTo(3)); });
+
+      it("can retrieve the back element", [&v]() { AssertThat(v.back(), Is().EqualTo(2)); });
+
+      it("can retrieve elements via '.at(i)'", [&v]() {
+        AssertThat(v.at(0), Is().EqualTo(3));
+        AssertThat(v.at(1), Is().EqualTo(1));
+        AssertThat(v.at(2), Is().EqualTo(2));
+      });
+
+      it("can pop element", [&v]() {
+        v.pop_back();
+
+        AssertThat(v.empty(), Is().False());
+        AssertThat(v.size(), Is().EqualTo(2u));
+      });
+
+      it("can retrieve different element from the back",
+         [&v]() { AssertThat(v.back(), Is().EqualTo(1)); });
+
+      it("can new elements", [&v]() {
+        v.push_back(4);
+        v.push_back(4);
+
+        AssertThat(v.empty(), Is().False());
+        AssertThat(v.size(), Is().EqualTo(4u));
+      });
+
+      it("can retrieve elements via '[i]'", [&v]() {
+        AssertThat(v[0], Is().EqualTo(3));
+        AssertThat(v[1], Is().EqualTo(1));
+        AssertThat(v[2], Is().EqualTo(4));
+        AssertThat(v[3], Is().EqualTo(4));
+      });
+
+      it("can iterate forwards through the vector", [&v]() {
+        int i                 = 0;
+        const int expected[4] = { 3, 1, 4, 4 };
+
+        for (auto iter = v.begin(); iter != v.end(); ++iter) {
+          AssertThat(*iter, Is().EqualTo(expected[i]));
+          i += 1;
+        }
+        AssertThat(i, Is().EqualTo(4));
+      });
+
+      it("can iterate backwards through the vector", [&v]() {
+        int i                 = 3;
+        const int expected[4] = { 3, 1, 4, 4 };
+
+        for (auto iter = v.rbegin(); iter != v.rend(); ++iter) {
+          AssertThat(*iter, Is().EqualTo(expected[i]));
+          i -= 1;
+        }
+        AssertThat(i, Is().EqualTo(-1));
+      });
+
+      it("can interleave two iterators over many blocks", []() {
+        vector<memory_mode::External, int> w;
+        for (int i = 0; i < 100000; ++i) { w.push_back(i); }
+
+        auto fst = w.begin();
+        auto snd = w.begin();
+
+        for (int i = 0; i < 100000; ++i) {
+          AssertThat(*(fst++), Is().EqualTo(i));
+          if (i % 2 == 0) { AssertThat(*(snd++), Is().EqualTo(i / 2)); }
+        }
+        AssertThat(fst == w.end(), Is().True());
+      });
     });
   });
 });
@@ -65,6 +65,35 @@ go_bandit([]() {
       });
     });
 
+    describe(".has_max_2level_cut(), .max_2level_cut()", [&] {
+      it("has no cut when created from (0,1)", [&]() {
+        const level_info li(0, 1);
+        AssertThat(li.has_max_2level_cut(), Is().False());
+      });
+
+      it("creates and retrieves from (0,1,0)", [&]() {
+        const level_info li(0, 1, 0);
+        AssertThat(li.has_max_2level_cut(), Is().True());
+        AssertThat(li.max_2level_cut(), Is().EqualTo(0u));
+      });
+
+      it("creates and retrieves from (42,8,21)", [&]() {
+        const level_info li(42, 8, 21);
+        AssertThat(li.has_max_2level_cut(), Is().True());
+        AssertThat(li.max_2level_cut(), Is().EqualTo(21u));
+      });
+
+      it("has no cut when created from (42,8,no_cut)", [&]() {
+        const level_info li(42, 8, level_info::no_cut);
+        AssertThat(li.has_max_2level_cut(), Is().False());
+      });
+
+      it("has no cut when created from (42,8,max+1)", [&]() {
+        const level_info li(42, 8, static_cast<size_t>(level_info::no_cut) + 1u);
+        AssertThat(li.has_max_2level_cut(), Is().False());
+      });
+    });
+
     describe("to_string()", [] {
       it("prints { level: 0 (x0), size: 1 }", [&]() {
         const level_info li(0, 1);
@@ -75,6 +104,11 @@ go_bandit([]() {
         const level_info li(4, 2);
         AssertThat(li.to_string(), Is().EqualTo("{ 4 (x4) | width: 2 }"));
       });
+
+      it("prints { level: 4 (x4), size: 2, 2-level cut: 3 }", [&]() {
+        const level_info li(4, 2, 3);
+        AssertThat(li.to_string(), Is().EqualTo("{ 4 (x4) | width: 2, 2-level cut: 3 }"));
+      });
     });
 
     describe("operator ==", [&] {
@@ -125,6 +159,18 @@ go_bandit([]() {
         const level_info li_2(2, 1);
         AssertThat(li_1, Is().Not().EqualTo(li_2));
       });
+
+      it("checks (1,2,3) == (1,2,4)", [&]() {
+        const level_info li_1(1, 2, 3);
+        const level_info li_2(1, 2, 4);
+        AssertThat(li_1, Is().EqualTo(li_2));
+      });
+
+      it("checks (1,2,3) == (1,2)", [&]() {
+        const level_info li_1(1, 2, 3);
+        const level_info li_2(1, 2);
+        AssertThat(li_1, Is().EqualTo(li_2));
+      });
     });
 
     describe("shift_replace(const level_info&, ...)", [&] {
@@ -163,6 +209,12 @@ go_bandit([]() {
                         -static_cast<level_info::signed_level_type>(ptr_uint64::max_label)),
           Is().EqualTo(level_info(0, 1)));
       });
+
+      it("keeps the 2-level cut of (2,2,5) [+1]", [&]() {
+        const level_info li = shift_replace(level_info(2, 2, 5), +1);
+        AssertThat(li.has_max_2level_cut(), Is().True());
+        AssertThat(li.max_2level_cut(), Is().EqualTo(5u));
+      });
     });
   });
 });
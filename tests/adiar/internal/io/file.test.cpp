@@ -2,9 +2,12 @@
 #include <filesystem>
 
 #include <adiar/internal/io/file.h>
+#include <adiar/internal/io/file_pool.h>
+#include <adiar/internal/io/temp_dir.h>
 #include <adiar/internal/io/ifstream.h>
 #include <adiar/internal/io/iofstream.h>
 #include <adiar/internal/io/ofstream.h>
+#include <adiar/internal/io/page_cache.h>
 
 go_bandit([]() {
   describe("adiar/internal/io/file.h , ifstream.h , ofstream.h, iofstream.h", []() {
@@ -226,6 +229,173 @@ go_bandit([]() {
       });
     });
 
+    describe("file() [temporary directory]", [&curr_path]() {
+      it("is placed within one of the temporary directories", []() {
+        file<int> f;
+        AssertThat(temp_dir_idx(f.path()), Is().LessThan(temp_dir_count()));
+      });
+
+      it("is not within a temporary directory after being moved out of it", [&curr_path]() {
+        std::string new_path = curr_path + "after-move-path.adiar";
+        if (std::filesystem::exists(new_path)) {
+          // Clean up after prior test run
+          std::filesystem::remove(new_path);
+        }
+
+        file<int> f;
+        f.move(new_path);
+        AssertThat(temp_dir_idx(f.path()), Is().EqualTo(temp_dir_count()));
+      });
+    });
+
+    describe("file() [recycling]", []() {
+      before_each([&]() { adiar_set_file_recycling(true); });
+
+      after_each([&]() { adiar_set_file_recycling(false); });
+
+      it("is disabled by default", []() {
+        adiar_set_file_recycling(false);
+        AssertThat(adiar_file_recycling(), Is().False());
+        AssertThat(file_pool_capacity(), Is().EqualTo(0u));
+
+        std::string path;
+        { // Scope to destruct 'f' early
+          file<int> f;
+          f.touch();
+          path = f.path();
+        }
+        AssertThat(std::filesystem::exists(path), Is().False());
+        AssertThat(file_pool_size(), Is().EqualTo(0u));
+      });
+
+      it("hands over an existing temporary file to the pool when destructed", []() {
+        const size_t pool_size = file_pool_size();
+        std::string path;
+        { // Scope to destruct 'f' early
+          file<int> f;
+          f.touch();
+          path = f.path();
+        }
+        AssertThat(std::filesystem::exists(path), Is().False());
+        AssertThat(file_pool_size(), Is().EqualTo(std::min(pool_size + 1, file_pool_capacity())));
+      });
+
+      it("does not hand over a non-existing file to the pool", []() {
+        const size_t pool_size = file_pool_size();
+        {
+          file<int> f;
+        }
+        AssertThat(file_pool_size(), Is().EqualTo(pool_size));
+      });
+
+      it("reuses a recycled file when touched", []() {
+        { // Make sure the pool is non-empty
+          file<int> f;
+          f.touch();
+        }
+        const size_t pool_size = file_pool_size();
+        AssertThat(pool_size, Is().GreaterThan(0u));
+
+        file<int> f;
+        AssertThat(f.exists(), Is().False());
+
+        f.touch();
+        AssertThat(file_pool_size(), Is().EqualTo(pool_size - 1));
+        AssertThat(f.exists(), Is().True());
+        AssertThat(f.size(), Is().EqualTo(0u));
+      });
+
+      it("does not hand over a persisted file to the pool", []() {
+        const size_t pool_size = file_pool_size();
+        std::string path;
+        { // Scope to destruct 'f' early
+          file<int> f;
+          f.make_persistent();
+          path = f.path();
+        }
+        AssertThat(std::filesystem::exists(path), Is().True());
+        AssertThat(file_pool_size(), Is().EqualTo(pool_size));
+
+        // Clean up for this test
+        std::filesystem::remove(path);
+      });
+    });
+
+    describe("file() [move]", []() {
+      it("takes over the path and content when move-constructed", []() {
+        file<int> f1;
+        {
+          ofstream<int> fw(f1);
+          fw << 42;
+        }
+        const std::string path = f1.path();
+
+        file<int> f2(std::move(f1));
+        AssertThat(f2.path(), Is().EqualTo(path));
+        AssertThat(f2.exists(), Is().True());
+        AssertThat(f2.is_temp(), Is().True());
+        AssertThat(f2.size(), Is().EqualTo(1u));
+      });
+
+      it("clears the path of the moved-from file", []() {
+        file<int> f1;
+        f1.touch();
+        const std::string path = f1.path();
+
+        file<int> f2(std::move(f1));
+        AssertThat(f1.path(), Is().Not().EqualTo(path));
+        AssertThat(f1.exists(), Is().False());
+      });
+
+      it("keeps the file when the moved-from object is destructed", []() {
+        const size_t pool_size = file_pool_size();
+
+        file<int> f2;
+        {
+          file<int> f1;
+          {
+            ofstream<int> fw(f1);
+            fw << 21 << 42;
+          }
+          f2 = std::move(f1);
+        }
+        AssertThat(f2.exists(), Is().True());
+        AssertThat(f2.size(), Is().EqualTo(2u));
+        AssertThat(file_pool_size(), Is().EqualTo(pool_size));
+      });
+
+      it("keeps the file persisted when moved", []() {
+        std::string path;
+        {
+          file<int> f1;
+          f1.make_persistent();
+          path = f1.path();
+
+          file<int> f2(std::move(f1));
+          AssertThat(f2.is_persistent(), Is().True());
+        }
+        AssertThat(std::filesystem::exists(path), Is().True());
+
+        // Clean up for this test
+        std::filesystem::remove(path);
+      });
+
+      it("releases its own prior file when move-assigned", []() {
+        file<int> f1;
+        f1.touch();
+        const std::string f1_path = f1.path();
+
+        file<int> f2;
+        f2.touch();
+        const std::string f2_path = f2.path();
+
+        f2 = std::move(f1);
+        AssertThat(f2.path(), Is().EqualTo(f1_path));
+        AssertThat(std::filesystem::exists(f1_path), Is().True());
+        AssertThat(std::filesystem::exists(f2_path), Is().False());
+      });
+    });
+
     describe("file() + ifstream", []() {
       it("can attach to and detach from an empty file [con-/destructor]", []() {
         file<int> f;
@@ -427,6 +597,45 @@ go_bandit([]() {
         fs.close();
       });
 
+      it("can read written content [page cache eviction]", []() {
+        // Restore the global setting, even if an assertion fails.
+        struct evict_guard
+        {
+          evict_guard()
+          {
+            page_cache_evict_set(true);
+          }
+
+          ~evict_guard()
+          {
+            page_cache_evict_set(false);
+          }
+        } guard;
+
+        file<int> f;
+
+        ofstream<int> fw(f);
+        fw << 1 << 2 << 3;
+        fw.close();
+        AssertThat(fw.is_open(), Is().False());
+
+        ifstream<int, false> fs(f);
+        AssertThat(fs.can_pull(), Is().True());
+        AssertThat(fs.pull(), Is().EqualTo(1));
+        AssertThat(fs.can_pull(), Is().True());
+        AssertThat(fs.pull(), Is().EqualTo(2));
+        AssertThat(fs.can_pull(), Is().True());
+        AssertThat(fs.pull(), Is().EqualTo(3));
+        AssertThat(fs.can_pull(), Is().False());
+        fs.close();
+
+        // Read it again (after being evicted from the page cache).
+        fs.open(f);
+        AssertThat(fs.can_pull(), Is().True());
+        AssertThat(fs.pull(), Is().EqualTo(1));
+        fs.close();
+      });
+
       it("can read written content in reverse [1]", []() {
         file<int> f;
 
@@ -8,7 +8,82 @@ go_bandit([]() {
     describe("node_ofstream [ .unsafe_* ] + node_file::stats", []() {
       // TODO: does not update canonicity
       // TODO: does update number of terminals
-      // TODO: does increase 1-level and 2-level cuts
+      // TODO: does increase 1-level cuts
+
+      describe("2-level cut", []() {
+        // A chain of nodes c0, ..., c3 (x0 to x3) leads to r (x4). From there, a chain of nodes
+        // n1, ..., n4 (x5 to x8) each have an arc to b (x9) while r has an arc to b' (x9).
+        //
+        // The 1-level cut is 5 between x8 and x9. With an upper bound of 6 on it, the 2-level cut is
+        // bounded by 9. Yet, the 2-level cut of each level and the one below is at most 7.
+        const node::pointer_type terminal_F(false);
+        const node::pointer_type terminal_T(true);
+
+        const node b(9, node::max_id, terminal_F, terminal_T);
+        const node b_(9, node::max_id - 1, terminal_T, terminal_F);
+        const node n4(8, node::max_id, b.uid(), terminal_F);
+        const node n3(7, node::max_id, b.uid(), n4.uid());
+        const node n2(6, node::max_id, b.uid(), n3.uid());
+        const node n1(5, node::max_id, b.uid(), n2.uid());
+        const node r(4, node::max_id, b_.uid(), n1.uid());
+        const node c3(3, node::max_id, terminal_F, r.uid());
+        const node c2(2, node::max_id, terminal_F, c3.uid());
+        const node c1(1, node::max_id, terminal_F, c2.uid());
+        const node c0(0, node::max_id, terminal_F, c1.uid());
+
+        // Levels (bottom-up) with the internal arcs into, out of, and past them as well as out of
+        // the level below.
+        const std::vector<level_info> levels = {
+          level_info(9, 2, 5), level_info(8, 1, 6), level_info(7, 1, 7), level_info(6, 1, 7),
+          level_info(5, 1, 6), level_info(4, 1, 5), level_info(3, 1, 4), level_info(2, 1, 3),
+          level_info(1, 1, 3), level_info(0, 1, 2),
+        };
+
+        const auto write = [&](levelized_file<node>& nf, const bool all_cuts, const cuts_t& inc) {
+          node_ofstream nw(nf);
+          nw.unsafe_push(b);
+          nw.unsafe_push(b_);
+          nw.unsafe_push(n4);
+          nw.unsafe_push(n3);
+          nw.unsafe_push(n2);
+          nw.unsafe_push(n1);
+          nw.unsafe_push(r);
+          nw.unsafe_push(c3);
+          nw.unsafe_push(c2);
+          nw.unsafe_push(c1);
+          nw.unsafe_push(c0);
+
+          for (const level_info& li : levels) {
+            nw.unsafe_push(all_cuts || li.level() != 7 ? li : level_info(li.level(), li.width()));
+          }
+
+          nw.unsafe_set_1level_cut({ { 6u, 11u, 6u, 11u } });
+          nw.unsafe_inc_1level_cut(inc);
+        };
+
+        it("is derived from the cut of each level", [&]() {
+          levelized_file<node> nf;
+          write(nf, true, { { 0u, 0u, 0u, 0u } });
+
+          AssertThat(nf.level_cut_slack, Is().EqualTo(0u));
+          AssertThat(nf.max_2level_cut[cut::Internal], Is().EqualTo(7u));
+        });
+
+        it("includes the slack of the cut of each level", [&]() {
+          levelized_file<node> nf;
+          write(nf, true, { { 1u, 1u, 1u, 1u } });
+
+          AssertThat(nf.level_cut_slack, Is().EqualTo(1u));
+          AssertThat(nf.max_2level_cut[cut::Internal], Is().EqualTo(8u));
+        });
+
+        it("falls back to the 1-level cut if a level has no cut", [&]() {
+          levelized_file<node> nf;
+          write(nf, false, { { 0u, 0u, 0u, 0u } });
+
+          AssertThat(nf.max_2level_cut[cut::Internal], Is().EqualTo(9u));
+        });
+      });
     });
 
     describe("node_ofstream [ << ] + node_file::stats", []() {
@@ -1754,6 +1829,40 @@ go_bandit([]() {
         });
       });
 
+      describe(".children(...)", [&]() {
+        it("provides children of single-node level", [&]() {
+          node_raccess nra(nf_B);
+          nra.setup_next_level(1u);
+
+          AssertThat(nra.children(B_n2.uid()), Is().EqualTo(B_n2.children()));
+        });
+
+        it("provides out-of-order children of multi-node level", [&]() {
+          node_raccess nra(nf_B);
+          nra.setup_next_level(2u);
+
+          AssertThat(nra.children(B_n5.uid()), Is().EqualTo(B_n5.children()));
+          AssertThat(nra.children(B_n3.uid()), Is().EqualTo(B_n3.children()));
+          AssertThat(nra.children(B_n4.uid()), Is().EqualTo(B_n4.children()));
+        });
+
+        it("negates children on-the-fly", [&]() {
+          node_raccess nra(nf_B, true);
+          nra.setup_next_level(2u);
+
+          AssertThat(nra.children(B_n3.uid()), Is().EqualTo((!B_n3).children()));
+          AssertThat(nra.children(B_n5.uid()), Is().EqualTo((!B_n5).children()));
+        });
+      });
+
+      describe("::memory_usage(...)", [&]() {
+        it("stores less than a node per element of a level", [&]() {
+          AssertThat(node_raccess::memory_usage(1024u),
+                     Is().LessThan(node_ifstream<>::memory_usage()
+                                   + tpie::array<node>::memory_usage(1024u)));
+        });
+      });
+
       describe(".root()", [&]() {
         it("provides root for 'F' terminal", []() {
           levelized_file<node> nf;
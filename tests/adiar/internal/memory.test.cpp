@@ -0,0 +1,130 @@
+#include "../../test.h"
+
+#include <array>
+
+#include <adiar/internal/memory.h>
+
+/// Sets the memory limit mode and restores the previous one when leaving scope, also when an
+/// assertion fails.
+class memory_limit_mode_guard
+{
+  const memory_limit_mode _prev;
+
+public:
+  memory_limit_mode_guard(const memory_limit_mode m)
+    : _prev(adiar_memory_limit_mode())
+  {
+    adiar_set_memory_limit_mode(m);
+  }
+
+  ~memory_limit_mode_guard()
+  {
+    adiar_set_memory_limit_mode(_prev);
+  }
+};
+
+go_bandit([]() {
+  describe("adiar/internal/memory.h", []() {
+    describe("make_shared", []() {
+      it("accounts for the object in TPIE's memory manager", []() {
+        const size_t used_before = memory_used();
+        {
+          shared_ptr<std::array<char, 1024>> p = adiar::make_shared<std::array<char, 1024>>();
+          AssertThat(memory_used(), Is().GreaterThanOrEqualTo(used_before + 1024u));
+        }
+        AssertThat(memory_used(), Is().EqualTo(used_before));
+      });
+    });
+
+    describe("make_unique", []() {
+      it("accounts for the object in TPIE's memory manager", []() {
+        const size_t used_before = memory_used();
+        {
+          unique_ptr<std::array<char, 1024>> p = adiar::make_unique<std::array<char, 1024>>();
+          AssertThat(memory_used(), Is().EqualTo(used_before + 1024u));
+        }
+        AssertThat(memory_used(), Is().EqualTo(used_before));
+      });
+
+      it("moves the accounting along with the object", []() {
+        const size_t used_before = memory_used();
+        {
+          unique_ptr<std::array<char, 1024>> p;
+          {
+            unique_ptr<std::array<char, 1024>> q = adiar::make_unique<std::array<char, 1024>>();
+            p = std::move(q);
+          }
+          AssertThat(memory_used(), Is().EqualTo(used_before + 1024u));
+        }
+        AssertThat(memory_used(), Is().EqualTo(used_before));
+      });
+    });
+
+    describe("memory_allocator", []() {
+      it("accounts for the allocation in TPIE's memory manager", []() {
+        const size_t used_before = memory_used();
+
+        memory_allocator<int> a;
+        int* p = a.allocate(256);
+        AssertThat(memory_used(), Is().EqualTo(used_before + 256u * sizeof(int)));
+
+        a.deallocate(p, 256);
+        AssertThat(memory_used(), Is().EqualTo(used_before));
+      });
+
+      it("throws 'out_of_memory' beyond a hard memory limit", []() {
+        {
+          const memory_limit_mode_guard g(memory_limit_mode::Hard);
+          AssertThat(adiar_memory_limit_mode(), Is().EqualTo(memory_limit_mode::Hard));
+
+          const size_t used_before = memory_used();
+
+          memory_allocator<char> a;
+          AssertThrows(out_of_memory, a.allocate(tpie::get_memory_manager().limit() + 1u));
+          AssertThat(memory_used(), Is().EqualTo(used_before));
+        }
+        AssertThat(adiar_memory_limit_mode(), Is().EqualTo(memory_limit_mode::Soft));
+      });
+
+      it("reserves memory for bookkeeping with a hard memory limit", []() {
+        const size_t soft_available = memory_available();
+        {
+          const memory_limit_mode_guard g(memory_limit_mode::Hard);
+          AssertThat(memory_available(), Is().LessThan(soft_available));
+        }
+        AssertThat(memory_available(), Is().EqualTo(soft_available));
+      });
+    });
+
+    describe("memory_vector", []() {
+      it("accounts for its elements in TPIE's memory manager", []() {
+        const size_t used_before = memory_used();
+        {
+          memory_vector<int> v(256u, 0);
+          AssertThat(memory_used(), Is().GreaterThanOrEqualTo(used_before + 256u * sizeof(int)));
+        }
+        AssertThat(memory_used(), Is().EqualTo(used_before));
+      });
+    });
+
+    describe("adiar_set_memory_limit", []() {
+      it("can shrink and grow the memory limit", []() {
+        const size_t memory_limit = adiar_memory_limit();
+
+        adiar_set_memory_limit(minimum_memory);
+        AssertThat(adiar_memory_limit(), Is().EqualTo(minimum_memory));
+        AssertThat(memory_available(), Is().LessThanOrEqualTo(minimum_memory));
+
+        adiar_set_memory_limit(memory_limit);
+        AssertThat(adiar_memory_limit(), Is().EqualTo(memory_limit));
+      });
+
+      it("throws 'invalid_argument' when given 'minimum_memory - 1' memory", []() {
+        const size_t memory_limit = adiar_memory_limit();
+
+        AssertThrows(invalid_argument, adiar_set_memory_limit(minimum_memory - 1));
+        AssertThat(adiar_memory_limit(), Is().EqualTo(memory_limit));
+      });
+    });
+  });
+});
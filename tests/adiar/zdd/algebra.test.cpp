@@ -0,0 +1,167 @@
+#include "../../test.h"
+
+#include <vector>
+
+go_bandit([]() {
+  describe("adiar/zdd/algebra.cpp", [&]() {
+    // Family of sets from a list of sets (each in ascending order)
+    const auto family = [](const std::vector<std::vector<int>>& sets) -> zdd {
+      zdd res = zdd_empty();
+      for (const std::vector<int>& s : sets) {
+        res = zdd_union(res, zdd_vars(s.rbegin(), s.rend()));
+      }
+      return res;
+    };
+
+    // { Ø, {0}, {0,2}, {1,2} }
+    const zdd A = family({ {}, { 0 }, { 0, 2 }, { 1, 2 } });
+
+    // { {1}, {3} }
+    const zdd B = family({ { 1 }, { 3 } });
+
+    // { {0,1}, {0,3}, {1,2}, {2}, {0} }
+    const zdd C = family({ { 0, 1 }, { 0, 3 }, { 1, 2 }, { 2 }, { 0 } });
+
+    describe("zdd_join(A, B)", [&]() {
+      it("returns Ø for Ø and A", [&]() {
+        AssertThat(zdd_join(zdd_empty(), A) == zdd_empty(), Is().True());
+        AssertThat(zdd_join(A, zdd_empty()) == zdd_empty(), Is().True());
+      });
+
+      it("returns A for { Ø } and A", [&]() {
+        AssertThat(zdd_join(zdd_null(), A) == A, Is().True());
+        AssertThat(zdd_join(A, zdd_null()) == A, Is().True());
+      });
+
+      it("computes pairwise unions of A and B", [&]() {
+        const zdd expected = family(
+          { { 1 }, { 3 }, { 0, 1 }, { 0, 3 }, { 0, 1, 2 }, { 0, 2, 3 }, { 1, 2 }, { 1, 2, 3 } });
+
+        AssertThat(zdd_join(A, B) == expected, Is().True());
+        AssertThat(zdd_join(B, A) == expected, Is().True());
+      });
+
+      it("is idempotent on a family closed under union", [&]() {
+        const zdd D = family({ {}, { 0 }, { 1 }, { 0, 1 } });
+        AssertThat(zdd_join(D, D) == D, Is().True());
+      });
+    });
+
+    describe("zdd_meet(A, B)", [&]() {
+      it("returns Ø for Ø and A", [&]() {
+        AssertThat(zdd_meet(zdd_empty(), A) == zdd_empty(), Is().True());
+        AssertThat(zdd_meet(A, zdd_empty()) == zdd_empty(), Is().True());
+      });
+
+      it("returns { Ø } for { Ø } and A", [&]() {
+        AssertThat(zdd_meet(zdd_null(), A) == zdd_null(), Is().True());
+      });
+
+      it("computes pairwise intersections of A and B", [&]() {
+        AssertThat(zdd_meet(A, B) == family({ {}, { 1 } }), Is().True());
+      });
+
+      it("computes pairwise intersections of C with itself", [&]() {
+        const zdd expected =
+          family({ {}, { 0 }, { 1 }, { 2 }, { 0, 1 }, { 0, 3 }, { 1, 2 } });
+        AssertThat(zdd_meet(C, C) == expected, Is().True());
+      });
+    });
+
+    describe("zdd_quotient(A, B)", [&]() {
+      it("returns Ø when dividing by Ø", [&]() {
+        AssertThat(zdd_quotient(A, zdd_empty()) == zdd_empty(), Is().True());
+      });
+
+      it("returns A when dividing by { Ø }", [&]() {
+        AssertThat(zdd_quotient(A, zdd_null()) == A, Is().True());
+      });
+
+      it("divides by a single set", [&]() {
+        // C / { {0} } = { {1}, {3}, Ø }
+        AssertThat(zdd_quotient(C, family({ { 0 } })) == family({ {}, { 1 }, { 3 } }), Is().True());
+      });
+
+      it("divides by multiple sets", [&]() {
+        // C / { {0}, {2} } = { Ø, {1} }
+        const zdd expected = family({ {}, { 1 } });
+        AssertThat(zdd_quotient(C, family({ { 0 }, { 2 } })) == expected, Is().True());
+      });
+
+      it("returns Ø if nothing divides", [&]() {
+        AssertThat(zdd_quotient(C, family({ { 3 }, { 4 } })) == zdd_empty(), Is().True());
+      });
+    });
+
+    describe("zdd_remainder(A, B)", [&]() {
+      it("returns A when dividing by Ø", [&]() {
+        AssertThat(zdd_remainder(A, zdd_empty()) == A, Is().True());
+      });
+
+      it("returns Ø when dividing by { Ø }", [&]() {
+        AssertThat(zdd_remainder(A, zdd_null()) == zdd_empty(), Is().True());
+      });
+
+      it("computes the remainder of dividing by multiple sets", [&]() {
+        // C / { {0}, {2} } = { Ø, {1} } and so only {0,3} is not removed.
+        const zdd expected = family({ { 0, 3 } });
+        AssertThat(zdd_remainder(C, family({ { 0 }, { 2 } })) == expected, Is().True());
+      });
+    });
+
+    describe("zdd_atmost(A, k)", [&]() {
+      it("returns the terminals unchanged", [&]() {
+        AssertThat(zdd_atmost(zdd_empty(), 0) == zdd_empty(), Is().True());
+        AssertThat(zdd_atmost(zdd_null(), 0) == zdd_null(), Is().True());
+      });
+
+      it("returns { Ø } for k = 0 if Ø is in A", [&]() {
+        AssertThat(zdd_atmost(A, 0) == zdd_null(), Is().True());
+      });
+
+      it("returns Ø for k = 0 if Ø is not in A", [&]() {
+        AssertThat(zdd_atmost(C, 0) == zdd_empty(), Is().True());
+      });
+
+      it("removes the sets larger than k", [&]() {
+        AssertThat(zdd_atmost(A, 1) == family({ {}, { 0 } }), Is().True());
+        AssertThat(zdd_atmost(C, 1) == family({ { 2 }, { 0 } }), Is().True());
+      });
+
+      it("returns A if k is at least the size of its support", [&]() {
+        AssertThat(zdd_atmost(C, 4) == C, Is().True());
+        AssertThat(zdd_atmost(C, 10) == C, Is().True());
+      });
+
+      it("keeps all sets of the powerset of size at most k", [&]() {
+        const std::vector<int> vars = { 0, 1, 2, 3, 4 };
+        const zdd P = zdd_powerset(vars.rbegin(), vars.rend());
+
+        const zdd res = zdd_atmost(P, 2);
+        AssertThat(zdd_size(res), Is().EqualTo(1u + 5u + 10u));
+      });
+
+      it("has one node per reachable budget on each level", [&]() {
+        const std::vector<int> vars = { 0, 1, 2, 3, 4 };
+        const zdd P = zdd_powerset(vars.rbegin(), vars.rend());
+
+        // Level 0 has budget 2, level 4 only budget 1, and all others budgets 1 and 2.
+        const zdd res = zdd_atmost(P, 2);
+        AssertThat(zdd_nodecount(res), Is().EqualTo(8u));
+
+        level_info_test_ifstream ms(res);
+        AssertThat(ms.can_pull(), Is().True());
+        AssertThat(ms.pull(), Is().EqualTo(level_info(4, 1u)));
+        AssertThat(ms.can_pull(), Is().True());
+        AssertThat(ms.pull(), Is().EqualTo(level_info(3, 2u)));
+        AssertThat(ms.can_pull(), Is().True());
+        AssertThat(ms.pull(), Is().EqualTo(level_info(2, 2u)));
+        AssertThat(ms.can_pull(), Is().True());
+        AssertThat(ms.pull(), Is().EqualTo(level_info(1, 2u)));
+        AssertThat(ms.can_pull(), Is().True());
+        AssertThat(ms.pull(), Is().EqualTo(level_info(0, 1u)));
+        AssertThat(ms.can_pull(), Is().False());
+      });
+    });
+  });
+});
@@ -98,6 +98,11 @@ go_bandit([]() {
     }
 
     describe("zdd_minelem(A)", [&]() {
+      it("returns the same set with an external memory stack", [&]() {
+        const exec_policy ep = exec_policy::memory::External;
+        AssertThat(zdd_minelem(ep, zdd_1) == zdd_minelem(zdd_1), Is().True());
+      });
+
       it("finds Ø on Ø", [&]() {
         zdd out = zdd_minelem(zdd_F);
 
@@ -426,6 +431,11 @@ go_bandit([]() {
     });
 
     describe("zdd_maxelem(A)", [&]() {
+      it("returns the same set with an external memory stack", [&]() {
+        const exec_policy ep = exec_policy::memory::External;
+        AssertThat(zdd_maxelem(ep, zdd_1) == zdd_maxelem(zdd_1), Is().True());
+      });
+
       it("finds Ø on Ø", [&]() {
         zdd out = zdd_maxelem(zdd_F);
 
@@ -712,5 +722,79 @@ go_bandit([]() {
         AssertThat(out.at(2), Is().EqualTo(2u));
       });
     });
+
+    describe("zdd_elements(A, c)", [&]() {
+      using set_type    = std::vector<zdd::label_type>;
+      using output_type = std::vector<set_type>;
+
+      const auto elements = [](const zdd& A, const exec_policy& ep = exec_policy()) -> output_type {
+        output_type out;
+        zdd_elements(ep, A, [&out](const generator<zdd::label_type>& g) {
+          set_type set;
+          optional<zdd::label_type> x;
+          while ((x = g())) { set.push_back(x.value()); }
+          out.push_back(set);
+        });
+        return out;
+      };
+
+      it("outputs nothing for Ø", [&]() {
+        const output_type out = elements(zdd_F);
+        AssertThat(out.size(), Is().EqualTo(0u));
+      });
+
+      it("outputs the empty set for { Ø }", [&]() {
+        const output_type out = elements(zdd_T);
+        AssertThat(out.size(), Is().EqualTo(1u));
+        AssertThat(out.at(0).size(), Is().EqualTo(0u));
+      });
+
+      it("outputs { 1 }, { 1,2 }, { 0 }, { 0,2 } for [1]", [&]() {
+        const output_type out = elements(zdd_1);
+        AssertThat(out.size(), Is().EqualTo(4u));
+        AssertThat(out.at(0), Is().EqualTo(set_type{ 1 }));
+        AssertThat(out.at(1), Is().EqualTo(set_type{ 1, 2 }));
+        AssertThat(out.at(2), Is().EqualTo(set_type{ 0 }));
+        AssertThat(out.at(3), Is().EqualTo(set_type{ 0, 2 }));
+      });
+
+      it("outputs Ø, { 2 }, { 2,3 }, { 1 } for [2]", [&]() {
+        const output_type out = elements(zdd_2);
+        AssertThat(out.size(), Is().EqualTo(4u));
+        AssertThat(out.at(0), Is().EqualTo(set_type{}));
+        AssertThat(out.at(1), Is().EqualTo(set_type{ 2 }));
+        AssertThat(out.at(2), Is().EqualTo(set_type{ 2, 3 }));
+        AssertThat(out.at(3), Is().EqualTo(set_type{ 1 }));
+      });
+
+      it("outputs { 1 }, { 0,1 } for [4]", [&]() {
+        const output_type out = elements(zdd_4);
+        AssertThat(out.size(), Is().EqualTo(2u));
+        AssertThat(out.at(0), Is().EqualTo(set_type{ 1 }));
+        AssertThat(out.at(1), Is().EqualTo(set_type{ 0, 1 }));
+      });
+
+      it("outputs as many sets as zdd_size(A) [1]", [&]() {
+        AssertThat(elements(zdd_1).size(), Is().EqualTo(zdd_size(zdd_1)));
+      });
+
+      it("outputs { 1 }, { 1,2 }, { 0 }, { 0,2 } for [1] [external memory]", [&]() {
+        const output_type out = elements(zdd_1, exec_policy::memory::External);
+        AssertThat(out.size(), Is().EqualTo(4u));
+        AssertThat(out.at(0), Is().EqualTo(set_type{ 1 }));
+        AssertThat(out.at(1), Is().EqualTo(set_type{ 1, 2 }));
+        AssertThat(out.at(2), Is().EqualTo(set_type{ 0 }));
+        AssertThat(out.at(3), Is().EqualTo(set_type{ 0, 2 }));
+      });
+
+      it("outputs Ø, { 2 }, { 2,3 }, { 1 } for [2] [external memory]", [&]() {
+        const output_type out = elements(zdd_2, exec_policy::memory::External);
+        AssertThat(out.size(), Is().EqualTo(4u));
+        AssertThat(out.at(0), Is().EqualTo(set_type{}));
+        AssertThat(out.at(1), Is().EqualTo(set_type{ 2 }));
+        AssertThat(out.at(2), Is().EqualTo(set_type{ 2, 3 }));
+        AssertThat(out.at(3), Is().EqualTo(set_type{ 1 }));
+      });
+    });
   });
 });
@@ -16,10 +16,19 @@ go_bandit([]() {
     it("throws exception when given 'minimum_memory - 1' memory",
        [&]() { AssertThrows(invalid_argument, adiar_init(minimum_memory - 1)); });
 
+    it("throws exception when changing the memory limit", [&]() {
+      AssertThrows(domain_error, adiar_set_memory_limit(minimum_memory));
+      AssertThat(adiar_memory_limit(), Is().EqualTo(0u));
+    });
+
     it("can run 'adiar_init()'", [&]() { adiar_init(1024 * 1024 * 1024); });
 
     it("is then initialized", [&]() { AssertThat(adiar_initialized(), Is().True()); });
 
+    it("has the given memory limit", [&]() {
+      AssertThat(adiar_memory_limit(), Is().EqualTo(1024u * 1024u * 1024u));
+    });
+
     it("can rerun 'adiar_init()' without any new effect", [&]() {
       AssertThat(adiar_initialized(), Is().True());
       adiar_init(1024 * 1024 * 1024);
@@ -48,6 +57,7 @@ go_bandit([]() {
 #include "adiar/internal/algorithms/isomorphism.test.cpp"
 #include "adiar/internal/algorithms/nested_sweeping.test.cpp"
 #include "adiar/internal/algorithms/reduce.test.cpp"
+#include "adiar/internal/data_structures/buffer_pool.test.cpp"
 #include "adiar/internal/data_structures/level_merger.test.cpp"
 #include "adiar/internal/data_structures/levelized_priority_queue.test.cpp"
 #include "adiar/internal/data_structures/priority_queue.test.cpp"
@@ -59,12 +69,14 @@ go_bandit([]() {
 #include "adiar/internal/data_types/request.test.cpp"
 #include "adiar/internal/data_types/tuple.test.cpp"
 #include "adiar/internal/data_types/uid.test.cpp"
+#include "adiar/internal/cut_profile.test.cpp"
 #include "adiar/internal/dd_func.test.cpp"
 #include "adiar/internal/io/arc_file.test.cpp"
 #include "adiar/internal/io/file.test.cpp"
 #include "adiar/internal/io/levelized_file.test.cpp"
 #include "adiar/internal/io/node_file.test.cpp"
 #include "adiar/internal/io/shared_file_ptr.test.cpp"
+#include "adiar/internal/memory.test.cpp"
 #include "adiar/internal/util.test.cpp"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -79,6 +91,7 @@ go_bandit([]() {
 #include "adiar/bdd/apply.test.cpp"
 #include "adiar/bdd/bdd.test.cpp"
 #include "adiar/bdd/build.test.cpp"
+#include "adiar/bdd/constrain.test.cpp"
 #include "adiar/bdd/count.test.cpp"
 #include "adiar/bdd/evaluate.test.cpp"
 #include "adiar/bdd/if_then_else.test.cpp"
@@ -92,6 +105,7 @@ go_bandit([]() {
 
 ////////////////////////////////////////////////////////////////////////////////
 // Adiar ZDD unit tests
+#include "adiar/zdd/algebra.test.cpp"
 #include "adiar/zdd/binop.test.cpp"
 #include "adiar/zdd/build.test.cpp"
 #include "adiar/zdd/change.test.cpp"